@@ -0,0 +1,47 @@
+#include "Bench.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "../Source/Memory/HeapStats.h"
+
+namespace
+{
+    volatile float sKeep = 0.0f;
+    std::string sFilter;
+}
+
+size_t Bench::GetAllocationCount()
+{
+    return HeapStats::GetAllocationCount();
+}
+
+uint64_t Bench::NowNanoseconds()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+void Bench::Keep(float value)
+{
+    sKeep = value;
+}
+
+void Bench::SetFilter(const char* filter)
+{
+    sFilter = filter ? filter : "";
+}
+
+bool Bench::IsSelected(const char* name)
+{
+    return sFilter.empty() || std::strstr(name, sFilter.c_str()) != nullptr;
+}
+
+void Bench::Report(const char* name, uint64_t iterations, uint64_t nanoseconds, size_t allocations)
+{
+    double ops = static_cast<double>(iterations ? iterations : 1);
+    std::printf("%-40s %12.1f ns/op %10.2f allocs/op %10llu ops\n", name,
+                static_cast<double>(nanoseconds) / ops, static_cast<double>(allocations) / ops,
+                static_cast<unsigned long long>(iterations));
+    std::fflush(stdout);
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Tiny harness for contra-diction-bench: times a loop and counts the heap
+// allocations made inside it (counted by HeapStats, which replaces the global operator new).
+namespace Bench
+{
+    // operator new calls so far, from every thread
+    size_t GetAllocationCount();
+    uint64_t NowNanoseconds();
+
+    // Keeps a result alive so the optimizer can't drop the work behind it
+    void Keep(float value);
+
+    // Only benchmarks whose name contains the filter run (empty runs all)
+    void SetFilter(const char* filter);
+    bool IsSelected(const char* name);
+
+    void Report(const char* name, uint64_t iterations, uint64_t nanoseconds, size_t allocations);
+
+    // Runs op a few times to warm caches, then `iterations` times measured
+    template <typename Op>
+    void Run(const char* name, uint64_t iterations, Op&& op)
+    {
+        if (!IsSelected(name))
+        {
+            return;
+        }
+
+        for (uint64_t i = 0; i < iterations / 10 + 1; i++)
+        {
+            op();
+        }
+
+        size_t allocations = GetAllocationCount();
+        uint64_t start = NowNanoseconds();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            op();
+        }
+        uint64_t elapsed = NowNanoseconds() - start;
+
+        Report(name, iterations, elapsed, GetAllocationCount() - allocations);
+    }
+
+    // Same, for ops too heavy to repeat on the same state: setup runs
+    // before every op and is left out of both the time and the allocations
+    template <typename Setup, typename Op>
+    void RunWithSetup(const char* name, uint64_t iterations, Setup&& setup, Op&& op)
+    {
+        if (!IsSelected(name))
+        {
+            return;
+        }
+
+        uint64_t elapsed = 0;
+        size_t allocations = 0;
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            setup();
+
+            size_t allocationsBefore = GetAllocationCount();
+            uint64_t start = NowNanoseconds();
+            op();
+            elapsed += NowNanoseconds() - start;
+            allocations += GetAllocationCount() - allocationsBefore;
+        }
+
+        Report(name, iterations, elapsed, allocations);
+    }
+}
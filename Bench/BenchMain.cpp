@@ -0,0 +1,239 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "Bench.h"
+#include "../Source/Game.h"
+#include "../Source/AudioSystem.h"
+#include "../Source/Actors/Actor.h"
+#include "../Source/Components/Physics/AABBColliderComponent.h"
+#include "../Source/Components/Physics/RigidBodyComponent.h"
+#include "../Source/Components/Drawing/AnimatorComponent.h"
+#include "../Source/Jobs/JobSystem.h"
+
+// contra-diction-bench [filter]
+// Engine hot paths with synthetic inputs, on a headless Game (null renderer
+// and audio). Run it from the build folder, like the game, to find ../Assets.
+
+namespace
+{
+    const float DT = 1.0f / Game::FPS;
+
+    // Destroys everything the previous benchmark spawned
+    void ClearScene(Game& game)
+    {
+        game.UnloadScene();
+        game.UpdateActors(0.0f);
+    }
+
+    Actor* SpawnBlock(Game& game, const Vector2& position)
+    {
+        auto* block = new Actor(&game);
+        block->SetPosition(position);
+        new AABBColliderComponent(block, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Blocks, false, true);
+        return block;
+    }
+
+    void BenchCollision(Game& game)
+    {
+        const int NUM_BLOCKS = 64;
+
+        // A floor of blocks, and a 32x32 body sunk a few pixels into it
+        AABBColliderComponent* blocks[NUM_BLOCKS];
+        for (int i = 0; i < NUM_BLOCKS; i++)
+        {
+            Actor* block = SpawnBlock(game, Vector2(i * static_cast<float>(Game::TILE_SIZE), 400.0f));
+            blocks[i] = block->GetComponent<AABBColliderComponent>();
+        }
+
+        auto* body = new Actor(&game);
+        body->SetPosition(Vector2(320.0f, 372.0f));
+        auto* rigidBody = new RigidBodyComponent(body, 1.0f, 0.0f, false);
+        auto* collider = new AABBColliderComponent(body, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Player);
+
+        int next = 0;
+        Bench::Run("aabb/intersect", 10000000, [&]() {
+            Bench::Keep(collider->Intersect(*blocks[next]) ? 1.0f : 0.0f);
+            next = (next + 1) % NUM_BLOCKS;
+        });
+
+        // Each op is a frame as far as the scratch arena is concerned
+        Bench::Run("aabb/detect+resolve vs blocks", 1000000, [&]() {
+            game.GetFrameArena()->Reset();
+            body->SetPosition(Vector2(320.0f, 372.0f));
+            rigidBody->SetVelocity(Vector2(100.0f, 200.0f));
+            collider->DetectHorizontalCollision(rigidBody);
+            collider->DetectVertialCollision(rigidBody);
+            Bench::Keep(body->GetPosition().y);
+        });
+
+        int step = 0;
+        rigidBody->SetApplyGravity(true);
+        Bench::Run("rigidbody/update on floor", 1000000, [&]() {
+            game.GetFrameArena()->Reset();
+            if (step++ % 256 == 0)
+            {
+                body->SetPosition(Vector2(320.0f, 360.0f));
+                rigidBody->SetVelocity(Vector2(150.0f, 0.0f));
+            }
+            rigidBody->Update(DT);
+            Bench::Keep(body->GetPosition().y);
+        });
+
+        ClearScene(game);
+    }
+
+    void BenchRigidBody(Game& game)
+    {
+        auto* body = new Actor(&game);
+        auto* rigidBody = new RigidBodyComponent(body, 1.0f, 5.0f, true);
+
+        int step = 0;
+        Bench::Run("rigidbody/update free fall", 10000000, [&]() {
+            if (step++ % 256 == 0)
+            {
+                body->SetPosition(Vector2::Zero);
+                rigidBody->SetVelocity(Vector2(300.0f, -600.0f));
+            }
+            rigidBody->ApplyForce(Vector2(50.0f, 0.0f));
+            rigidBody->Update(DT);
+            Bench::Keep(body->GetPosition().x);
+        });
+
+        ClearScene(game);
+    }
+
+    void BenchAnimator(Game& game)
+    {
+        auto* goomba = new Actor(&game);
+        auto* animator = new AnimatorComponent(goomba, "../Assets/Sprites/Goomba/Goomba.png",
+                                               "../Assets/Sprites/Goomba/Goomba.json",
+                                               Game::TILE_SIZE, Game::TILE_SIZE);
+        animator->AddAnimation("dead", {0});
+        animator->AddAnimation("walk", {1, 2});
+        animator->SetAnimation("walk");
+
+        Bench::Run("animator/update + frame", 10000000, [&]() {
+            animator->Update(DT);
+            Bench::Keep(static_cast<float>(animator->GetCurrentFrameIndex()));
+        });
+
+        ClearScene(game);
+    }
+
+    void BenchMatrix()
+    {
+        static const Vector3 corners[4] = {
+            Vector3(-0.5f, -0.5f, 0.0f), Vector3(0.5f, -0.5f, 0.0f),
+            Vector3(0.5f, 0.5f, 0.0f), Vector3(-0.5f, 0.5f, 0.0f)
+        };
+
+        // Model matrix of Renderer::DrawRect/DrawGeometry, then the quad corners through it
+        float t = 0.0f;
+        Bench::Run("matrix4/sprite model + 4 corners", 10000000, [&]() {
+            t += 0.001f;
+            Matrix4 model = Matrix4::CreateScale(Vector3(32.0f, 48.0f, 1.0f)) *
+                            Matrix4::CreateRotationZ(t) *
+                            Matrix4::CreateTranslation(Vector3(100.0f + t, 200.0f, 0.0f));
+
+            float sum = 0.0f;
+            for (const Vector3& corner : corners)
+            {
+                Vector3 world = Vector3::Transform(corner, model);
+                sum += world.x + world.y;
+            }
+            Bench::Keep(sum);
+        });
+    }
+
+    void BenchJobs(Game& game)
+    {
+        JobSystem* jobs = game.GetJobs();
+
+        Bench::Run("jobs/schedule + wait empty job", 100000, [&]() {
+            JobCounter counter;
+            jobs->Schedule("Bench::Empty", []() {}, &counter);
+            jobs->Wait(counter);
+        });
+
+        // Enough work per item that splitting it should pay off
+        std::vector<float> values(1 << 16, 1.0f);
+        Bench::Run("jobs/parallel for 64k items", 2000, [&]() {
+            jobs->ParallelFor("Bench::ParallelFor", values.size(), 1024, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    values[i] = Math::Sqrt(values[i] * values[i] + 1.0f);
+                }
+            });
+            Bench::Keep(values[0]);
+        });
+    }
+
+    void BenchLevelLoad(Game& game)
+    {
+        Bench::RunWithSetup("level/build Level1.tmj", 20,
+            [&]() { ClearScene(game); },
+            [&]() { game.BuildLevelFromJSON("../Assets/Levels/Level1ContraDiction/Level1.tmj"); });
+
+        ClearScene(game);
+    }
+
+    void BenchAudio()
+    {
+        const char* name = "audio/play sound (8 channels)";
+        if (!Bench::IsSelected(name))
+        {
+            return;
+        }
+
+        // A real mixer on SDL's dummy driver: channels fill up and stay busy,
+        // so most calls go through the replacement policy
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+        if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0)
+        {
+            std::printf("%-40s skipped: %s\n", name, SDL_GetError());
+            return;
+        }
+
+        const std::string sounds[] = { "Bump.wav", "Coin.wav", "Jump.wav", "Kick.wav" };
+
+        auto* audio = new AudioSystem(8);
+        for (const auto& sound : sounds)
+        {
+            audio->CacheSound(sound);
+        }
+
+        int next = 0;
+        Bench::Run(name, 200000, [&]() {
+            audio->PlaySound(sounds[next]);
+            next = (next + 1) % 4;
+        });
+
+        delete audio;
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Bench::SetFilter(argc > 1 ? argv[1] : "");
+
+    Game game;
+    game.SetHeadless(true);
+    if (!game.Initialize())
+    {
+        game.Shutdown();
+        return 1;
+    }
+
+    BenchCollision(game);
+    BenchRigidBody(game);
+    BenchAnimator(game);
+    BenchMatrix();
+    BenchJobs(game);
+    BenchLevelLoad(game);
+    BenchAudio();
+
+    game.Shutdown();
+    return 0;
+}
@@ -11,26 +11,23 @@
 
 // This corresponds to the output color to the color buffer
 out vec4 outColor;
-uniform vec4 uColor;
 
 // This is used for the texture sampling
 uniform sampler2D uTexture;
 
-// This is used for texture blending
-uniform float uTextureFactor;
-
-// Global alpha multiplier
-uniform float uGlobalAlpha;
-
-// Circle mode
-uniform float uIsCircle;
-
 // Tex coord input from vertex shader
 in vec2 fragTexCoord;
 
+// Color and (global alpha, texture factor, circle mode) from the vertex shader
+in vec4 fragColor;
+in vec3 fragParams;
+
 void main()
 {
-    if (uIsCircle > 0.5) {
+    float globalAlpha = fragParams.x;
+    float textureFactor = fragParams.y;
+
+    if (fragParams.z > 0.5) {
         // Radial gradient for blurred circle (Gaussian-like soft particle)
         float dist = distance(fragTexCoord, vec2(0.5, 0.5));
         // 0.5 is the radius. We want it to fade out before hitting the corners.
@@ -43,11 +40,11 @@ void main()
             alpha = 0.0;
         }
         
-        outColor = uColor * alpha;
-        outColor.a *= uGlobalAlpha;
+        outColor = fragColor * alpha;
+        outColor.a *= globalAlpha;
     } else {
         vec4 texColor = texture(uTexture, fragTexCoord);
-        outColor = mix(uColor, texColor, uTextureFactor);
-        outColor.a *= uGlobalAlpha;
+        outColor = mix(fragColor, texColor, textureFactor);
+        outColor.a *= globalAlpha;
     }
 }
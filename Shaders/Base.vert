@@ -15,16 +15,28 @@ layout (location = 0) in vec2 inPosition;
 // Attribute 1 is texture coordinate
 layout(location = 1) in vec2 inTexCoord;
 
+// Sprite batch only: color and (global alpha, texture factor, circle)
+layout(location = 2) in vec4 inColor;
+layout(location = 3) in vec3 inParams;
+
 uniform mat4 uWorldTransform;
 uniform mat4 uOrthoProj;
 uniform vec4 uColor;
 uniform vec2 uCameraPos;
+uniform float uGlobalAlpha;
+uniform float uTextureFactor;
+uniform float uIsCircle;
+
+// Set while the renderer flushes a sprite batch
+uniform float uUseVertexColor;
 
 // (u0, v0, u1, v1) for current sprite frame
 uniform vec4 uTexRect;
 
 // Any vertex outputs (other than position)
 out vec2 fragTexCoord;
+out vec4 fragColor;
+out vec3 fragParams;
 
 void main()
 {
@@ -40,4 +52,13 @@ void main()
     // Pass the texture coordinate to the fragment shader
     // Scale and offset the input texture coordinate to map to the correct sprite
     fragTexCoord = inTexCoord * uTexRect.zw + uTexRect.xy;
+
+    // Per-draw uniforms or per-vertex values from the batch
+    if (uUseVertexColor > 0.5) {
+        fragColor = inColor;
+        fragParams = inParams;
+    } else {
+        fragColor = uColor;
+        fragParams = vec3(uGlobalAlpha, uTextureFactor, uIsCircle);
+    }
 }
\ No newline at end of file
@@ -1,12 +1,11 @@
 #version 330
 out vec4 outColor;
-uniform vec4 uColor;
 uniform sampler2D uTexture;
-uniform float uTextureFactor;
-uniform float uGlobalAlpha;
 
 in vec2 fragTexCoord;
 in vec2 fragWorldPos;
+in vec4 fragColor;
+in vec3 fragParams; // (global alpha, texture factor, unused)
 
 #define MAX_LIGHTS 16
 uniform vec2 uLightPositions[MAX_LIGHTS];
@@ -24,7 +23,7 @@ uniform float uFlashlightAngle; // In radians (half angle)
 void main()
 {
     vec4 texColor = texture(uTexture, fragTexCoord);
-    vec4 baseColor = mix(uColor, texColor, uTextureFactor);
+    vec4 baseColor = mix(fragColor, texColor, fragParams.y);
     
     vec3 lighting = uAmbientLight;
     
@@ -68,5 +67,5 @@ void main()
     
     lighting = clamp(lighting, 0.0, 1.0);
     
-    outColor = vec4(baseColor.rgb * lighting, baseColor.a * uGlobalAlpha);
+    outColor = vec4(baseColor.rgb * lighting, baseColor.a * fragParams.x);
 }
@@ -1,6 +1,9 @@
 #version 330
 layout (location = 0) in vec2 inPosition;
 layout (location = 1) in vec2 inTexCoord;
+// Sprite batch only: color and (global alpha, texture factor, circle)
+layout (location = 2) in vec4 inColor;
+layout (location = 3) in vec3 inParams;
 
 uniform mat4 uWorldTransform;
 uniform mat4 uOrthoProj;
@@ -8,9 +11,15 @@ uniform vec2 uCameraPos;
 uniform vec4 uTexRect;
 uniform float uTime;
 uniform float uIsVegetation;
+uniform vec4 uColor;
+uniform float uGlobalAlpha;
+uniform float uTextureFactor;
+uniform float uUseVertexColor;
 
 out vec2 fragTexCoord;
 out vec2 fragWorldPos;
+out vec4 fragColor;
+out vec3 fragParams;
 
 void main()
 {
@@ -29,4 +38,12 @@ void main()
     worldPos.xy -= uCameraPos;
     gl_Position = uOrthoProj * worldPos;
     fragTexCoord = inTexCoord * uTexRect.zw + uTexRect.xy;
+
+    if (uUseVertexColor > 0.5) {
+        fragColor = inColor;
+        fragParams = inParams;
+    } else {
+        fragColor = uColor;
+        fragParams = vec3(uGlobalAlpha, uTextureFactor, 0.0);
+    }
 }
@@ -9,6 +9,7 @@
 #include "Actor.h"
 #include "../Game.h"
 #include "../Components/Component.h"
+#include "../Memory/SceneArena.h"
 #include <algorithm>
 
 #include "../Components/Drawing/SpriteComponent.h"
@@ -18,12 +19,30 @@ Actor::Actor(Game* game)
         , mPosition(Vector2::Zero)
         , mScale(Vector2(1.0f, 1.0f))
         , mRotation(0.0f)
+        , mPrevPosition(Vector2::Zero)
+        , mPrevRotation(0.0f)
+        , mSimPosition(Vector2::Zero)
+        , mSimRotation(0.0f)
+        , mHasPrevTransform(false)
         , mGame(game)
         , mGasHitCount(0)
         , mOriginalColor(1.0f, 1.0f, 1.0f)
         , mHasStoredOriginalColor(false)
+        , mComponentTableDirty(false)
+        , mThinks(false)
+        , mPool(nullptr)
 {
-    mGame->AddActor(this);
+    mHandle = mGame->AddActor(this);
+}
+
+void* Actor::operator new(size_t size)
+{
+    return SceneArena::AllocateObject(size);
+}
+
+void Actor::operator delete(void* p)
+{
+    SceneArena::FreeObject(p);
 }
 
 Actor::~Actor()
@@ -37,6 +56,54 @@ Actor::~Actor()
     mComponents.clear();
 }
 
+void Actor::ReleaseToPool()
+{
+    // Game queued it under the handle being dropped here
+    FlushComponentTable();
+    mGame->RemoveActor(this);
+
+    for (auto component : mComponents)
+    {
+        component->OnPoolRelease();
+    }
+}
+
+void Actor::ReturnFromPool()
+{
+    // Same as the constructor leaves a new actor
+    mState = ActorState::Active;
+    mPosition = Vector2::Zero;
+    mScale = Vector2(1.0f, 1.0f);
+    mRotation = 0.0f;
+    mPrevPosition = Vector2::Zero;
+    mPrevRotation = 0.0f;
+    mSimPosition = Vector2::Zero;
+    mSimRotation = 0.0f;
+    mHasPrevTransform = false;
+    mGasHitCount = 0;
+    mOriginalColor = Vector3(1.0f, 1.0f, 1.0f);
+    mHasStoredOriginalColor = false;
+    mIsOnGround = false;
+
+    // A fresh handle: anything still holding the old one sees it as dead
+    mHandle = mGame->AddActor(this);
+
+    for (auto component : mComponents)
+    {
+        component->SetEnabled(true);
+        component->OnPoolAcquire();
+    }
+}
+
+void Actor::SetState(ActorState state)
+{
+    if (state == ActorState::Destroy && mState != ActorState::Destroy)
+    {
+        mGame->AddDeadActor(this);
+    }
+    mState = state;
+}
+
 void Actor::Update(float deltaTime)
 {
     if (mState == ActorState::Active)
@@ -52,11 +119,72 @@ void Actor::Update(float deltaTime)
     }
 }
 
+void Actor::UpdateRemaining(float deltaTime)
+{
+    if (mState == ActorState::Active)
+    {
+        for (auto comp : mComponents)
+        {
+            if (comp->IsEnabled() && !comp->IsUpdatedBySystem()) {
+                comp->Update(deltaTime);
+            }
+        }
+
+        OnUpdate(deltaTime);
+    }
+}
+
+void Actor::SavePreviousTransform()
+{
+    mPrevPosition = mPosition;
+    mPrevRotation = mRotation;
+    mHasPrevTransform = true;
+}
+
+void Actor::ApplyInterpolatedTransform(float alpha)
+{
+    mSimPosition = mPosition;
+    mSimRotation = mRotation;
+
+    // Spawned during the last tick: nothing to blend from yet
+    if (!mHasPrevTransform)
+    {
+        return;
+    }
+
+    mPosition = Vector2::Lerp(mPrevPosition, mPosition, alpha);
+
+    // Shortest way around, so angles crossing +-Pi don't spin
+    float delta = mRotation - mPrevRotation;
+    while (delta > Math::Pi) delta -= Math::TwoPi;
+    while (delta < -Math::Pi) delta += Math::TwoPi;
+    mRotation = mPrevRotation + delta * alpha;
+}
+
+void Actor::RestoreSimulatedTransform()
+{
+    mPosition = mSimPosition;
+    mRotation = mSimRotation;
+}
+
 void Actor::OnUpdate(float deltaTime)
 {
 
 }
 
+void Actor::Think(float deltaTime, ActorCommands& commands)
+{
+    if (mState == ActorState::Active)
+    {
+        OnThink(deltaTime, commands);
+    }
+}
+
+void Actor::OnThink(float /*deltaTime*/, ActorCommands& /*commands*/)
+{
+
+}
+
 void Actor::ProcessInput(const Uint8* keyState)
 {
 
@@ -112,8 +240,55 @@ void Actor::HitByGas()
 
 void Actor::AddComponent(Component* c)
 {
-    mComponents.emplace_back(c);
-    std::sort(mComponents.begin(), mComponents.end(), [](Component* a, Component* b) {
-        return a->GetUpdateOrder() < b->GetUpdateOrder();
-    });
+    // Already sorted: insert after every component with the same update order
+    auto iter = std::upper_bound(mComponents.begin(), mComponents.end(), c->GetUpdateOrder(),
+        [](int updateOrder, Component* other) {
+            return updateOrder < other->GetUpdateOrder();
+        });
+    mComponents.insert(iter, c);
+
+    // Rebuilt once for all the components added before the next flush
+    if (!mComponentTableDirty)
+    {
+        mComponentTableDirty = true;
+        mGame->AddDirtyComponentTable(this);
+    }
+}
+
+Component* Actor::FindComponent(ComponentTypeId id) const
+{
+    // Same answer as the table: the first one in update order
+    for (auto c : mComponents)
+    {
+        if (c->GetTypeId() == id)
+        {
+            return c;
+        }
+    }
+    return nullptr;
+}
+
+void Actor::FlushComponentTable()
+{
+    if (!mComponentTableDirty)
+    {
+        return;
+    }
+
+    mComponentTable.clear();
+    for (auto c : mComponents)
+    {
+        ComponentTypeId id = c->GetTypeId();
+        if (id >= mComponentTable.size())
+        {
+            mComponentTable.resize(id + 1, nullptr);
+        }
+
+        // Update order wins, like the old linear search
+        if (!mComponentTable[id])
+        {
+            mComponentTable[id] = c;
+        }
+    }
+    mComponentTableDirty = false;
 }
\ No newline at end of file
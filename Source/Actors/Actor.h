@@ -11,6 +11,8 @@
 #include <SDL_stdinc.h>
 #include "../Math.h"
 #include "../Renderer/Renderer.h"
+#include "ActorRegistry.h"
+#include "../Components/Component.h"
 
 enum class ActorState
 {
@@ -25,11 +27,22 @@ public:
     Actor(class Game* game);
     virtual ~Actor();
 
+    // Actors built while a scene loads live in its SceneArena (see Game::PerformLoad)
+    static void* operator new(size_t size);
+    static void operator delete(void* p);
+
     // Update function called from Game (not overridable)
     void Update(float deltaTime);
+    // System update mode: only the components no system sweeps, then OnUpdate
+    void UpdateRemaining(float deltaTime);
     // ProcessInput function called from Game (not overridable)
     void ProcessInput(const Uint8* keyState);
 
+    // Parallel think phase, after the regular update of every actor: only
+    // actors that called EnableThink, on any job thread (see Game::ThinkActors)
+    bool Thinks() const { return mThinks; }
+    void Think(float deltaTime, class ActorCommands& commands);
+
     // Position getter/setter
     const Vector2& GetPosition() const { return mPosition; }
     void SetPosition(const Vector2& pos) { mPosition = pos; }
@@ -42,9 +55,22 @@ public:
     float GetRotation() const { return mRotation; }
     void SetRotation(float rotation) { mRotation = rotation; }
 
-    // State getter/setter
+    // Fixed timestep: the transform at the start of the tick is kept so the
+    // actor can be drawn between the last two simulation steps
+    void SavePreviousTransform();
+    // Swaps in the blended transform for drawing; Restore puts the simulated one back
+    void ApplyInterpolatedTransform(float alpha);
+    void RestoreSimulatedTransform();
+
+    // State getter/setter (Destroy queues the actor for deletion, so don't assign mState directly)
     ActorState GetState() const { return mState; }
-    void SetState(ActorState state) { mState = state; }
+    void SetState(ActorState state);
+
+    // Weak reference for anything that may outlive this actor (see Game::GetActor)
+    ActorHandle GetHandle() const { return mHandle; }
+
+    // Pool this actor goes back to instead of being deleted (see ActorPool)
+    class ActorPoolBase* GetPool() const { return mPool; }
 
     // Game getter
     class Game* GetGame() { return mGame; }
@@ -52,22 +78,26 @@ public:
     // Components getter
     const std::vector<class Component*>& GetComponents() const { return mComponents; }
 
-    // Returns component of type T, or null if doesn't exist
+    // Returns component of type T (exact type, see COMPONENT_TYPE), or null if doesn't exist.
+    // Never writes. Only thread-safe on a clean table: Game flushes them
+    // before every parallel phase. Until then, an actor that just got a
+    // component falls back to a linear search
     template <typename T>
     T* GetComponent() const
     {
-        for (auto c : mComponents)
+        ComponentTypeId id = Component::TypeIdOf<T>();
+        if (mComponentTableDirty)
         {
-            T* t = dynamic_cast<T*>(c);
-            if (t != nullptr)
-            {
-                return t;
-            }
+            return static_cast<T*>(FindComponent(id));
         }
 
-        return nullptr;
+        return id < mComponentTable.size() ? static_cast<T*>(mComponentTable[id]) : nullptr;
     }
 
+    // Rebuilds the lookup table after components were added. Main thread
+    // only; Game calls it for every actor queued by AddComponent
+    void FlushComponentTable();
+
     // Game specific
     void SetOnGround() { mIsOnGround = true; };
     void SetOffGround() { mIsOnGround = false; };
@@ -89,6 +119,13 @@ protected:
     // Any actor-specific update code (overridable)
     virtual void OnProcessInput(const Uint8* keyState);
 
+    // AI that may run in parallel with other actors' OnThink. Every actor's
+    // position and state stay frozen for the whole phase: read anything, but
+    // only change this actor's own members and components, and send the rest
+    // (moving, destroying, spawning, sounds, texts, Random) through commands
+    virtual void OnThink(float deltaTime, class ActorCommands& commands);
+    void EnableThink() { mThinks = true; }
+
     // Actor's state
     ActorState mState;
 
@@ -96,6 +133,13 @@ protected:
     Vector2 mPosition;
     Vector2 mScale;
     float mRotation;
+
+    // Render interpolation
+    Vector2 mPrevPosition;
+    float mPrevRotation;
+    Vector2 mSimPosition;
+    float mSimRotation;
+    bool mHasPrevTransform;
     
     // Gas logic
     int mGasHitCount;
@@ -109,9 +153,27 @@ protected:
     bool mIsOnGround;
 
 private:
+
+    ActorHandle mHandle;
+
+    // First component of each type id, indexed by id. Components can't report
+    // their type while still being constructed, so the table is rebuilt by
+    // FlushComponentTable, not by AddComponent
+    class Component* FindComponent(ComponentTypeId id) const;
+    std::vector<class Component*> mComponentTable;
+    bool mComponentTableDirty;
+
     friend class Component;
+    friend class ActorPoolBase;
+
+    // Out of / back into Game's lists, for ActorPool
+    void ReleaseToPool();
+    void ReturnFromPool();
 
     // Adds component to Actor (this is automatically called
     // in the component constructor)
     void AddComponent(class Component* c);
+
+    bool mThinks;
+    class ActorPoolBase* mPool;
 };
\ No newline at end of file
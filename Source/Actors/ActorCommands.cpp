@@ -0,0 +1,106 @@
+#include "ActorCommands.h"
+#include <algorithm>
+#include <utility>
+#include "Actor.h"
+#include "../Game.h"
+#include "../Memory/FrameArena.h"
+
+ActorCommands::ActorCommands()
+    : mOrder(0)
+{
+}
+
+ActorCommands::Command& ActorCommands::Append(Type type)
+{
+    mCommands.emplace_back();
+    Command& command = mCommands.back();
+    command.type = type;
+    command.order = mOrder;
+    command.actor = nullptr;
+    command.duration = 0.0f;
+    return command;
+}
+
+void ActorCommands::Destroy(Actor* actor)
+{
+    Append(Type::Destroy).actor = actor;
+}
+
+void ActorCommands::SetPosition(Actor* actor, const Vector2& position)
+{
+    Command& command = Append(Type::SetPosition);
+    command.actor = actor;
+    command.position = position;
+}
+
+void ActorCommands::PlaySound(const std::string& soundName)
+{
+    Append(Type::PlaySound).text = soundName;
+}
+
+void ActorCommands::AddFloatingText(const Vector2& pos, const std::string& text, float duration, Actor* owner)
+{
+    Command& command = Append(Type::FloatingText);
+    command.actor = owner;
+    command.position = pos;
+    command.text = text;
+    command.duration = duration;
+}
+
+void ActorCommands::Defer(std::function<void()> func)
+{
+    Append(Type::Defer).func = std::move(func);
+}
+
+void ActorCommands::ApplyAll(std::vector<ActorCommands>& buffers, Game* game)
+{
+    // An actor thinks on a single thread, so its commands sit together in
+    // one buffer; (order, position in that buffer) is a total order
+    size_t numCommands = 0;
+    for (ActorCommands& buffer : buffers)
+    {
+        numCommands += buffer.mCommands.size();
+    }
+
+    auto sorted = game->GetFrameArena()->MakeVector<std::pair<uint64_t, Command*>>(numCommands);
+    for (ActorCommands& buffer : buffers)
+    {
+        for (size_t i = 0; i < buffer.mCommands.size(); i++)
+        {
+            Command& command = buffer.mCommands[i];
+            sorted.emplace_back((static_cast<uint64_t>(command.order) << 32) | i, &command);
+        }
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    for (auto& entry : sorted)
+    {
+        Command& command = *entry.second;
+        switch (command.type)
+        {
+            case Type::Destroy:
+                command.actor->SetState(ActorState::Destroy);
+                break;
+            case Type::SetPosition:
+                command.actor->SetPosition(command.position);
+                break;
+            case Type::PlaySound:
+                game->GetAudio()->PlaySound(command.text);
+                break;
+            case Type::FloatingText:
+                game->AddFloatingText(command.position, command.text, command.duration, command.actor);
+                break;
+            case Type::Defer:
+                command.func();
+                break;
+        }
+    }
+
+    for (ActorCommands& buffer : buffers)
+    {
+        buffer.mCommands.clear();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "../Math.h"
+
+// Everything an actor may not do itself in the parallel think phase (see
+// Actor::OnThink): destroying or moving actors, sounds, floating texts, and
+// through Defer anything else that touches the world (spawning actors,
+// particles, the shared Random). Each job thread fills its own buffer and
+// Game applies them on the main thread, sorted by actor, so the outcome is
+// the same however the actors were split between threads.
+class ActorCommands
+{
+public:
+    ActorCommands();
+
+    void Destroy(class Actor* actor);
+    void SetPosition(class Actor* actor, const Vector2& position);
+    void PlaySound(const std::string& soundName);
+    void AddFloatingText(const Vector2& pos, const std::string& text, float duration, class Actor* owner);
+    // Runs func on the main thread, after the think phase
+    void Defer(std::function<void()> func);
+
+    // Applies every buffer's commands in the order the actors were thought
+    // (then issued), and empties them
+    static void ApplyAll(std::vector<ActorCommands>& buffers, class Game* game);
+
+private:
+    friend class Game;
+
+    enum class Type
+    {
+        Destroy,
+        SetPosition,
+        PlaySound,
+        FloatingText,
+        Defer
+    };
+
+    struct Command
+    {
+        Type type;
+        // Dense index of the actor that issued it
+        uint32_t order;
+        class Actor* actor;
+        Vector2 position;
+        float duration;
+        std::string text;
+        std::function<void()> func;
+    };
+
+    Command& Append(Type type);
+
+    // Set by Game before each actor thinks
+    void SetOrder(uint32_t order) { mOrder = order; }
+
+    std::vector<Command> mCommands;
+    uint32_t mOrder;
+};
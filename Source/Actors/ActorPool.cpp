@@ -0,0 +1,56 @@
+#include "ActorPool.h"
+#include <algorithm>
+#include "Actor.h"
+#include "../Game.h"
+
+ActorPoolBase::ActorPoolBase(const char* name)
+    : mName(name)
+    , mGame(nullptr)
+    , mLive(0)
+    , mPeak(0)
+    , mCreated(0)
+{
+}
+
+void ActorPoolBase::OnAcquired(Game* game)
+{
+    if (!mGame)
+    {
+        mGame = game;
+        game->AddActorPool(this);
+    }
+
+    mLive++;
+    mPeak = std::max(mPeak, mLive);
+}
+
+void ActorPoolBase::Adopt(Actor* actor)
+{
+    actor->mPool = this;
+    mCreated++;
+}
+
+void ActorPoolBase::Reactivate(Actor* actor)
+{
+    actor->ReturnFromPool();
+}
+
+void ActorPoolBase::Release(Actor* actor)
+{
+    actor->ReleaseToPool();
+    // Holds at most the peak, so this stops allocating after warm-up
+    mFree.emplace_back(actor);
+    mLive--;
+}
+
+void ActorPoolBase::Clear()
+{
+    // Out of every Game list already: deleting only has to free them
+    for (Actor* actor : mFree)
+    {
+        delete actor;
+    }
+    mFree.clear();
+    mLive = 0;
+    mGame = nullptr;
+}
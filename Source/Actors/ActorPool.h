@@ -0,0 +1,78 @@
+#pragma once
+#include <utility>
+#include <vector>
+#include "../Memory/SceneArena.h"
+
+// Non-template side of ActorPool, what Game and Actor need to know
+class ActorPoolBase
+{
+public:
+    explicit ActorPoolBase(const char* name);
+    virtual ~ActorPoolBase() = default;
+
+    // Called by Game instead of deleting a pooled actor marked Destroy:
+    // takes it out of every Game list and keeps it for the next Acquire
+    void Release(class Actor* actor);
+
+    // Deletes the actors waiting in the pool (Game::Shutdown)
+    void Clear();
+
+    const char* GetName() const { return mName; }
+    int GetLiveCount() const { return mLive; }
+    // Most actors of this type alive at once; the pool holds that many
+    int GetPeakCount() const { return mPeak; }
+    int GetCreatedCount() const { return mCreated; }
+
+protected:
+    // Registers with game's pool list on first use, then counts one more live actor
+    void OnAcquired(class Game* game);
+    // Reactivates a released actor (new handle, components back in Game's lists)
+    void Reactivate(class Actor* actor);
+    void Adopt(class Actor* actor);
+
+    const char* mName;
+    class Game* mGame;
+    std::vector<class Actor*> mFree;
+    int mLive;
+    int mPeak;
+    int mCreated;
+};
+
+// Recycles actors of one type that are spawned and destroyed at a high rate
+// (bullets, gas clouds), so neither the actor nor its components go through
+// the heap or re-fetch textures and sprite sheets after warm-up.
+// T provides:
+//   T(Game* game, Args...)  builds the components, then calls Reset(Args...)
+//   void Reset(Args...)     sets everything that changes during a life
+// A reused actor comes back with the base Actor state of a new one: new
+// handle, Active, zero position and rotation, unit scale, every component
+// enabled. Keep the pool in the actor's .cpp, next to a static Spawn.
+template <typename T>
+class ActorPool : public ActorPoolBase
+{
+public:
+    explicit ActorPool(const char* name) : ActorPoolBase(name) {}
+
+    template <typename... Args>
+    T* Acquire(class Game* game, Args&&... args)
+    {
+        OnAcquired(game);
+
+        // Pooled actors outlive the scene: never from its arena, components
+        // built by the constructor or Reset included
+        SceneArena::Scope heap(nullptr);
+
+        if (mFree.empty())
+        {
+            T* actor = new T(game, std::forward<Args>(args)...);
+            Adopt(actor);
+            return actor;
+        }
+
+        T* actor = static_cast<T*>(mFree.back());
+        mFree.pop_back();
+        Reactivate(actor);
+        actor->Reset(std::forward<Args>(args)...);
+        return actor;
+    }
+};
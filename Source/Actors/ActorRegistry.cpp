@@ -0,0 +1,95 @@
+#include "ActorRegistry.h"
+
+ActorRegistry::ActorRegistry()
+    : mHoles(0)
+    , mCount(0)
+    , mTraversals(0)
+{
+}
+
+ActorHandle ActorRegistry::Add(Actor* actor)
+{
+    uint32_t index;
+    if (!mFreeSlots.empty())
+    {
+        index = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(mSlots.size());
+        mSlots.emplace_back();
+    }
+
+    Slot& slot = mSlots[index];
+    slot.actor = actor;
+    slot.denseIndex = static_cast<uint32_t>(mDense.size());
+
+    mDense.emplace_back(actor);
+    mDenseSlots.emplace_back(index);
+    mCount++;
+
+    ActorHandle handle;
+    handle.index = index;
+    handle.generation = slot.generation;
+    return handle;
+}
+
+void ActorRegistry::Remove(ActorHandle handle)
+{
+    if (!Get(handle))
+    {
+        return;
+    }
+
+    Slot& slot = mSlots[handle.index];
+    mDense[slot.denseIndex] = nullptr;
+    mHoles++;
+    mCount--;
+
+    // Outstanding handles to this slot go stale
+    slot.actor = nullptr;
+    slot.generation++;
+    if (slot.generation == 0)
+    {
+        slot.generation = 1;
+    }
+    mFreeSlots.emplace_back(handle.index);
+}
+
+Actor* ActorRegistry::Get(ActorHandle handle) const
+{
+    if (handle.IsNull() || handle.index >= mSlots.size())
+    {
+        return nullptr;
+    }
+
+    const Slot& slot = mSlots[handle.index];
+    return slot.generation == handle.generation ? slot.actor : nullptr;
+}
+
+void ActorRegistry::Compact()
+{
+    if (mHoles == 0 || mTraversals > 0)
+    {
+        return;
+    }
+
+    // Stable: survivors keep their relative order
+    size_t write = 0;
+    for (size_t read = 0; read < mDense.size(); read++)
+    {
+        if (mDense[read])
+        {
+            uint32_t slot = mDenseSlots[read];
+            mSlots[slot].denseIndex = static_cast<uint32_t>(write);
+            mDense[write] = mDense[read];
+            mDenseSlots[write] = slot;
+            write++;
+        }
+    }
+
+    mDense.resize(write);
+    mDenseSlots.resize(write);
+    mHoles = 0;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Weak reference to an actor: the slot it lives in plus the generation the
+// slot had when the actor was added. Game::GetActor turns it back into a
+// pointer, or null once that actor is gone (even if the slot was reused).
+struct ActorHandle
+{
+    uint32_t index = 0;
+    // 0 is never handed out, so a default handle is null
+    uint32_t generation = 0;
+
+    bool IsNull() const { return generation == 0; }
+
+    bool operator==(const ActorHandle& rhs) const { return index == rhs.index && generation == rhs.generation; }
+    bool operator!=(const ActorHandle& rhs) const { return !(*this == rhs); }
+    bool operator<(const ActorHandle& rhs) const
+    {
+        return index != rhs.index ? index < rhs.index : generation < rhs.generation;
+    }
+};
+
+// Slot map of every live actor. Add, Remove and handle lookups are O(1);
+// actors are visited in insertion order from a dense array, where removal
+// only leaves a hole until Compact (Game calls it once per update).
+class ActorRegistry
+{
+public:
+    ActorRegistry();
+
+    ActorHandle Add(class Actor* actor);
+    void Remove(ActorHandle handle);
+
+    // Null if the handle is null or stale
+    class Actor* Get(ActorHandle handle) const;
+
+    size_t GetCount() const { return mCount; }
+    // Dense slots including holes; pass it to ForEach to leave out actors added later
+    size_t GetSize() const { return mDense.size(); }
+    // Actor at a dense slot, null for a hole. Reading it from several threads
+    // is fine as long as nobody adds, removes or compacts meanwhile
+    class Actor* GetAt(size_t denseIndex) const { return mDense[denseIndex]; }
+
+    // Stable: survivors keep their relative order. Not during ForEach
+    void Compact();
+
+    // Calls func(actor) in insertion order, for the first `limit` dense slots.
+    // Actors added while it runs are not visited, and removing any actor
+    // (func's included) is safe
+    template <typename Func>
+    void ForEach(Func&& func, size_t limit = static_cast<size_t>(-1))
+    {
+        mTraversals++;
+        size_t count = limit < mDense.size() ? limit : mDense.size();
+        for (size_t i = 0; i < count; i++)
+        {
+            if (mDense[i])
+            {
+                func(mDense[i]);
+            }
+        }
+        mTraversals--;
+    }
+
+private:
+    struct Slot
+    {
+        class Actor* actor = nullptr;
+        uint32_t generation = 1;
+        uint32_t denseIndex = 0;
+    };
+
+    std::vector<Slot> mSlots;
+    std::vector<uint32_t> mFreeSlots;
+
+    std::vector<class Actor*> mDense;
+    // Slot of each mDense entry, to fix denseIndex when compacting
+    std::vector<uint32_t> mDenseSlots;
+    size_t mHoles;
+    size_t mCount;
+
+    // Running ForEach calls; compacting then would move actors under them
+    int mTraversals;
+};
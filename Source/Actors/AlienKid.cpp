@@ -1,4 +1,5 @@
 #include "AlienKid.h"
+#include "ActorCommands.h"
 #include "../Game.h"
 #include "../Components/Drawing/AnimatorComponent.h"
 #include "../Components/Physics/RigidBodyComponent.h"
@@ -64,14 +65,16 @@ AlienKid::AlienKid(Game* game)
 
     mRigidBodyComponent = new RigidBodyComponent(this);
     mColliderComponent = new AABBColliderComponent(this, 0, -1, 15, 30, ColliderLayer::Enemy);
+
+    EnableThink();
 }
 
-void AlienKid::OnUpdate(float deltaTime)
+void AlienKid::OnThink(float deltaTime, ActorCommands& commands)
 {
     if (mIsDying) {
         mDeathTimer -= deltaTime;
         if (mDeathTimer <= 0.0f) {
-            SetState(ActorState::Destroy);
+            commands.Destroy(this);
         }
         return;
     }
@@ -96,8 +99,8 @@ void AlienKid::OnUpdate(float deltaTime)
         }
     } else if (dist < mDetectionRadius) {
         if (!mHasPlayedActiveSound) {
-            GetGame()->GetAudio()->PlaySound("Confused.wav");
-            GetGame()->AddFloatingText(mPosition, "Tem joguinho no seu celular tio?", 2.0f, this);
+            commands.PlaySound("Confused.wav");
+            commands.AddFloatingText(mPosition, "Tem joguinho no seu celular tio?", 2.0f, this);
             mHasPlayedActiveSound = true;
         }
         // Approach
@@ -6,7 +6,7 @@ class AlienKid : public Actor
 public:
     explicit AlienKid(class Game* game);
 
-    void OnUpdate(float deltaTime) override;
+    void OnThink(float deltaTime, class ActorCommands& commands) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void Kill() override;
 
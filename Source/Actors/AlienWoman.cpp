@@ -1,4 +1,5 @@
 #include "AlienWoman.h"
+#include "ActorCommands.h"
 #include "../Game.h"
 #include "../Components/Drawing/AnimatorComponent.h"
 #include "../Components/Physics/RigidBodyComponent.h"
@@ -61,14 +62,16 @@ AlienWoman::AlienWoman(Game* game)
 
     mRigidBodyComponent = new RigidBodyComponent(this);
     mColliderComponent = new AABBColliderComponent(this, 0, -18, 60, 100, ColliderLayer::Enemy);
+
+    EnableThink();
 }
 
-void AlienWoman::OnUpdate(float deltaTime)
+void AlienWoman::OnThink(float deltaTime, ActorCommands& commands)
 {
     if (mIsDying) {
         mDeathTimer -= deltaTime;
         if (mDeathTimer <= 0.0f) {
-            SetState(ActorState::Destroy);
+            commands.Destroy(this);
         }
         return;
     }
@@ -93,8 +96,8 @@ void AlienWoman::OnUpdate(float deltaTime)
         }
     } else if (dist < mDetectionRadius) {
         if (!mHasPlayedActiveSound) {
-            GetGame()->GetAudio()->PlaySound("Confused.wav");
-            GetGame()->AddFloatingText(mPosition, "Um monstro!!", 2.0f, this);
+            commands.PlaySound("Confused.wav");
+            commands.AddFloatingText(mPosition, "Um monstro!!", 2.0f, this);
             mHasPlayedActiveSound = true;
         }
         if (dist < mMaintainDistance) {
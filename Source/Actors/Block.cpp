@@ -9,6 +9,7 @@
 #include "../Components/Drawing/AnimatorComponent.h"
 #include "../Components/Drawing/SpriteComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
+#include "../Physics/SpatialHashGrid.h"
 
 Block::Block(Game* game, const std::string &texturePath, bool hasMushroom)
         :Actor(game)
@@ -18,6 +19,7 @@ Block::Block(Game* game, const std::string &texturePath, bool hasMushroom)
         ,mIsUsed(false)
         ,mHasMushroom(hasMushroom)
         ,mFrameIndex(0)
+        ,mCollider(nullptr)
         ,mOriginalSrcX(0)
         ,mOriginalSrcY(0)
         ,mSize(Game::TILE_SIZE)
@@ -54,7 +56,7 @@ Block::Block(Game* game, const std::string &texturePath, bool hasMushroom)
     ac->SetAnimFPS(1.0f); 
 
     // Create AABB collider
-    new AABBColliderComponent(this, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Blocks, false, true);
+    mCollider = new AABBColliderComponent(this, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Blocks, false, true);
 }
 
 Block::Block(Game* game, Texture* texture, int srcX, int srcY, int size, bool isCollidable)
@@ -64,6 +66,7 @@ Block::Block(Game* game, Texture* texture, int srcX, int srcY, int size, bool is
     ,mIsUsed(false)
     ,mHasMushroom(false)
     ,mFrameIndex(0)
+    ,mCollider(nullptr)
     ,mOriginalSrcX(srcX)
     ,mOriginalSrcY(srcY)
     ,mSize(size)
@@ -86,8 +89,9 @@ Block::Block(Game* game, Texture* texture, int srcX, int srcY, int size, bool is
     // --- 2. FÍSICA ---
     // Cria o colisor.
     // ColliderLayer::Blocks é crucial para o Player saber que isso é chão.
+    // Estático: tiles não se movem, então o broadphase só os insere uma vez.
     if (isCollidable) {
-        new AABBColliderComponent(this, 0, 0, size, size, ColliderLayer::Blocks);
+        mCollider = new AABBColliderComponent(this, 0, 0, size, size, ColliderLayer::Blocks, false, true);
     }
 }
 
@@ -104,6 +108,11 @@ void Block::OnUpdate(float deltaTime)
             mPosition = mOriginalPos;
             mIsBumping = false;
         }
+
+        // Static colliders are not re-bucketed automatically
+        if (mCollider) {
+            GetGame()->GetCollisionGrid()->Update(mCollider);
+        }
     }
 }
 
@@ -124,7 +133,7 @@ void Block::Bump()
     if (blockCollider) {
         Vector2 blockTopLeft = blockCollider->GetMin();
 
-        for (auto collider : GetGame()->GetColliders()) {
+        GetGame()->GetColliders().ForEach([&](AABBColliderComponent* collider) {
             if (collider->GetLayer() == ColliderLayer::Enemy) {
                 Vector2 enemyBottomLeft = Vector2(collider->GetMin().x, collider->GetMax().y);
 
@@ -139,7 +148,7 @@ void Block::Bump()
                     collider->GetOwner()->Kill();
                 }
             }
-        }
+        });
     }
 
     // Generate item or coin based on block type
@@ -154,12 +163,12 @@ void Block::Bump()
 
         if (mHasMushroom) {
             // Generate a mushroom
-            auto* mushroom = new Mushroom(GetGame());
+            auto* mushroom = Mushroom::Spawn(GetGame());
             mushroom->SetPosition(Vector2(mPosition.x, mPosition.y));
         } else {
             // If no mushroom, generate a coin
             GetGame()->AddCoin();
-            auto* coin = new Coin(GetGame(), true);
+            auto* coin = Coin::Spawn(GetGame(), true);
             coin->SetPosition(Vector2(mPosition.x, mPosition.y));
         }
     }
@@ -5,21 +5,39 @@
 #include "../Components/Physics/RigidBodyComponent.h"
 #include "Spaceman.h"
 
+namespace
+{
+    ActorPool<CactusProjectile> sPool("CactusProjectile");
+}
+
+CactusProjectile* CactusProjectile::Spawn(Game* game, Actor* owner)
+{
+    return sPool.Acquire(game, owner);
+}
+
 CactusProjectile::CactusProjectile(Game* game, Actor* owner)
     : Actor(game)
-    , mOwner(owner)
-    , mLifeTime(0.0f)
 {
     mSprite = new SpriteComponent(this);
     mSprite->SetTexture(game->GetRenderer()->GetTexture("../Assets/Sprites/Cactus/cactus_projectile.PNG"));
     mSprite->SetIsCircle(true); // Assuming it's round-ish
-    SetScale(Vector2(0.3f, 0.3f)); // Even Smaller
 
     // Reduced collider size to 20x20 for better accuracy
     mCollider = new AABBColliderComponent(this, 0, 0, 20, 20, ColliderLayer::Enemy);
     
     // Set friction in constructor (mass=1.0f, friction=0.5f)
     mRigidBody = new RigidBodyComponent(this, 1.0f, 0.5f);
+
+    Reset(owner);
+}
+
+void CactusProjectile::Reset(Actor* owner)
+{
+    mOwner = owner;
+    mLifeTime = 0.0f;
+    SetScale(Vector2(0.3f, 0.3f)); // Even Smaller
+    // Gas may have tinted the last one
+    mSprite->SetColor(Vector3::One);
     mRigidBody->SetApplyGravity(true);
 }
 
@@ -1,10 +1,12 @@
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 
 class CactusProjectile : public Actor
 {
 public:
-    CactusProjectile(class Game* game, class Actor* owner);
+    static CactusProjectile* Spawn(class Game* game, class Actor* owner);
+
     void OnUpdate(float deltaTime) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void OnVerticalCollision(const float minOverlap, class AABBColliderComponent* other) override;
@@ -12,6 +14,11 @@ public:
     class RigidBodyComponent* GetRigidBody() { return mRigidBody; }
 
 private:
+    friend class ActorPool<CactusProjectile>;
+
+    CactusProjectile(class Game* game, class Actor* owner);
+    void Reset(class Actor* owner);
+
     class SpriteComponent* mSprite;
     class AABBColliderComponent* mCollider;
     class RigidBodyComponent* mRigidBody;
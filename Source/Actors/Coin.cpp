@@ -7,13 +7,20 @@
 #include "../Components/Drawing/AnimatorComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
 
+namespace
+{
+    // One per kind: collectable coins also have a collider
+    ActorPool<Coin> sEffectPool("Coin (effect)");
+    ActorPool<Coin> sCollectablePool("Coin");
+}
+
+Coin* Coin::Spawn(Game* game, bool isAnimatedEffect)
+{
+    return (isAnimatedEffect ? sEffectPool : sCollectablePool).Acquire(game, isAnimatedEffect);
+}
+
 Coin::Coin(Game* game, bool isAnimatedEffect)
     : Actor(game)
-    , mIsAnimatedEffect(isAnimatedEffect)
-    , mIsSpawning(true)
-    , mIsFalling(false)
-    , mSpawnStartPosition(Vector2::Zero)
-    , mLifeSpan(0.05f)
 {
     auto* ac = new AnimatorComponent(this, "../Assets/Sprites/Collectables/Collectables.png", "../Assets/Sprites/Collectables/Collectables.json", Game::TILE_SIZE, Game::TILE_SIZE, 98);
     ac->AddAnimation("idle", { 0 });
@@ -21,9 +28,20 @@ Coin::Coin(Game* game, bool isAnimatedEffect)
     ac->SetAnimFPS(1.0f);
 
     // If it's not an animated effect, add a collider
-    if (!mIsAnimatedEffect) {
+    if (!isAnimatedEffect) {
         new AABBColliderComponent(this, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Collectable, true);
     }
+
+    Reset(isAnimatedEffect);
+}
+
+void Coin::Reset(bool isAnimatedEffect)
+{
+    mSpawnStartPosition = Vector2::Zero;
+    mIsAnimatedEffect = isAnimatedEffect;
+    mIsSpawning = true;
+    mIsFalling = false;
+    mLifeSpan = 0.05f;
 }
 
 void Coin::OnUpdate(float deltaTime)
@@ -58,7 +76,7 @@ void Coin::OnUpdate(float deltaTime)
         } else { // Disappearing State
             mLifeSpan -= deltaTime;
             if (mLifeSpan <= 0.0f) {
-                mState = ActorState::Destroy;
+                SetState(ActorState::Destroy);
             }
         }
     }
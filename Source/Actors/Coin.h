@@ -4,13 +4,20 @@
 
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 
 class Coin : public Actor
 {
 public:
-    Coin(class Game* game, bool isAnimatedEffect = false);
+    static Coin* Spawn(class Game* game, bool isAnimatedEffect = false);
+
     void OnUpdate(float deltaTime) override;
 private:
+    friend class ActorPool<Coin>;
+
+    Coin(class Game* game, bool isAnimatedEffect);
+    void Reset(bool isAnimatedEffect);
+
     Vector2 mSpawnStartPosition;
     bool mIsAnimatedEffect;
     bool mIsSpawning;
@@ -4,11 +4,18 @@
 #include "../Components/Drawing/SpriteComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
 
+namespace
+{
+    ActorPool<EnemyLaser> sPool("EnemyLaser");
+}
+
+EnemyLaser* EnemyLaser::Spawn(Game* game, Actor* shooter)
+{
+    return sPool.Acquire(game, shooter);
+}
+
 EnemyLaser::EnemyLaser(Game* game, Actor* shooter)
     :Actor(game)
-    ,mLifeTime(3.0f)
-    ,mVelocity(Vector2::Zero)
-    ,mShooter(shooter)
 {
     // 1. Sprite
     SpriteComponent* sc = new SpriteComponent(this, 200);
@@ -20,6 +27,15 @@ EnemyLaser::EnemyLaser(Game* game, Actor* shooter)
     // 2. Colisor (TRIGGER)
     // Pequeno (8x8) para não ser injusto
     mBox = new AABBColliderComponent(this, 0, 0, 8, 8, ColliderLayer::EnemyProjectile, true, false);
+
+    Reset(shooter);
+}
+
+void EnemyLaser::Reset(Actor* shooter)
+{
+    mVelocity = Vector2::Zero;
+    mLifeTime = 3.0f;
+    mShooter = shooter;
 }
 
 void EnemyLaser::OnUpdate(float deltaTime)
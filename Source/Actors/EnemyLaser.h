@@ -1,10 +1,11 @@
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 
 class EnemyLaser : public Actor
 {
 public:
-    EnemyLaser(class Game* game, Actor* shooter = nullptr);
+    static EnemyLaser* Spawn(class Game* game, Actor* shooter = nullptr);
     
     void OnUpdate(float deltaTime) override;
     
@@ -18,6 +19,11 @@ public:
     void OnVerticalCollision(float overlap, class AABBColliderComponent* other) override;
 
 private:
+    friend class ActorPool<EnemyLaser>;
+
+    EnemyLaser(class Game* game, Actor* shooter);
+    void Reset(Actor* shooter);
+
     class AABBColliderComponent* mBox;
     Vector2 mVelocity;
     float mLifeTime;
@@ -1,4 +1,5 @@
 #include "FlowerBoss.h"
+#include "ActorCommands.h"
 #include "../Game.h"
 #include "../Components/Drawing/AnimatorComponent.h"
 #include "../Components/Physics/RigidBodyComponent.h"
@@ -77,9 +78,11 @@ FlowerBoss::FlowerBoss(Game* game, const std::string& reason)
     }
 
     ChangeState(0); // Start growing
+
+    EnableThink();
 }
 
-void FlowerBoss::OnUpdate(float deltaTime)
+void FlowerBoss::OnThink(float deltaTime, ActorCommands& commands)
 {
     mStateTimer += deltaTime;
     mAttackCooldown -= deltaTime;
@@ -109,13 +112,15 @@ void FlowerBoss::OnUpdate(float deltaTime)
                 } else if (mAttackCount == 1) {
                     ChangeState(4); // Force Crouch/Pillar
                 } else {
-                    float rand = Random::GetFloat();
                     // Randomly choose between Fly (Projectile) and Crouch (Pillar)
                     // Maybe keep some melee if close?
                     // User said: "then he chooses between throwing or cactus from the ground randomly"
                     // So let's prioritize those.
-                    if (rand < 0.5f) ChangeState(3);
-                    else ChangeState(4);
+                    commands.Defer([this]() {
+                        float rand = Random::GetFloat();
+                        if (rand < 0.5f) ChangeState(3);
+                        else ChangeState(4);
+                    });
                 }
             }
             break;
@@ -129,11 +134,9 @@ void FlowerBoss::OnUpdate(float deltaTime)
             
             if (mAttackCooldown <= 0.0f) {
                  mAttackCooldown = 1.5f;
-                 auto* bullet = new CactusProjectile(GetGame(), this);
-                 bullet->SetPosition(GetPosition());
                  Vector2 vel = diff;
                  vel.Normalize();
-                 bullet->GetRigidBody()->SetVelocity(vel * 600.0f); // Faster (was 200)
+                 commands.Defer([this, vel]() { ShootProjectile(vel * 600.0f); }); // Faster (was 200)
                  
                  if (mAttackCount == 0) mAttackCount++; // Increment only on first forced attack
             }
@@ -151,36 +154,8 @@ void FlowerBoss::OnUpdate(float deltaTime)
 
                 // Spawn Cactus Pillars
                 if (player) {
-                    // Define area around player
-                    float startX = player->GetPosition().x - 300.0f;
-                    float endX = player->GetPosition().x + 300.0f;
-                    // Use Player Y + 45 (approx half height) as ground level
-                    float groundY = player->GetPosition().y + 45.0f; 
-
-                    // Create safe spots
-                    std::vector<float> safeSpots;
-                    int numSafeSpots = Random::GetIntRange(1, 3);
-                    for(int i=0; i<numSafeSpots; i++) {
-                        safeSpots.push_back(Random::GetFloatRange(startX, endX));
-                    }
-
-                    // Spawn pillars in dangerous spots
-                    for (float x = startX; x <= endX; x += 120.0f) { // Increased spacing
-                        bool isSafe = false;
-                        for (float safeX : safeSpots) {
-                            if (abs(x - safeX) < 60.0f) { // Increased safe zone radius slightly
-                                isSafe = true;
-                                break;
-                            }
-                        }
-
-                        if (!isSafe) {
-                            // Random chance to spawn pillar
-                            if (Random::GetFloat() > 0.3f) {
-                                new CactusPillar(GetGame(), Vector2(x, groundY));
-                            }
-                        }
-                    }
+                    Vector2 playerPos = player->GetPosition();
+                    commands.Defer([this, playerPos]() { SpawnPillars(playerPos); });
                 }
             }
             
@@ -209,16 +184,55 @@ void FlowerBoss::OnUpdate(float deltaTime)
              if (mAttackCooldown <= 0.0f) {
                  mAttackCooldown = 2.0f;
                  // Shoot
-                 auto* bullet = new CactusProjectile(GetGame(), this);
-                 bullet->SetPosition(GetPosition());
                  Vector2 vel = diff;
                  vel.Normalize();
-                 bullet->GetRigidBody()->SetVelocity(vel * 400.0f);
+                 commands.Defer([this, vel]() { ShootProjectile(vel * 400.0f); });
              }
         }
     }
 }
 
+void FlowerBoss::ShootProjectile(const Vector2& velocity)
+{
+    auto* bullet = CactusProjectile::Spawn(GetGame(), this);
+    bullet->SetPosition(GetPosition());
+    bullet->GetRigidBody()->SetVelocity(velocity);
+}
+
+void FlowerBoss::SpawnPillars(const Vector2& playerPos)
+{
+    // Define area around player
+    float startX = playerPos.x - 300.0f;
+    float endX = playerPos.x + 300.0f;
+    // Use Player Y + 45 (approx half height) as ground level
+    float groundY = playerPos.y + 45.0f;
+
+    // Create safe spots
+    std::vector<float> safeSpots;
+    int numSafeSpots = Random::GetIntRange(1, 3);
+    for(int i=0; i<numSafeSpots; i++) {
+        safeSpots.push_back(Random::GetFloatRange(startX, endX));
+    }
+
+    // Spawn pillars in dangerous spots
+    for (float x = startX; x <= endX; x += 120.0f) { // Increased spacing
+        bool isSafe = false;
+        for (float safeX : safeSpots) {
+            if (abs(x - safeX) < 60.0f) { // Increased safe zone radius slightly
+                isSafe = true;
+                break;
+            }
+        }
+
+        if (!isSafe) {
+            // Random chance to spawn pillar
+            if (Random::GetFloat() > 0.3f) {
+                new CactusPillar(GetGame(), Vector2(x, groundY));
+            }
+        }
+    }
+}
+
 void FlowerBoss::ChangeState(int state)
 {
     mState = state;
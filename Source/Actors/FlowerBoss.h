@@ -5,12 +5,15 @@ class FlowerBoss : public Actor
 {
 public:
     FlowerBoss(class Game* game, const std::string& reason);
-    void OnUpdate(float deltaTime) override;
+    void OnThink(float deltaTime, class ActorCommands& commands) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void Kill() override;
 
 private:
     void ChangeState(int state);
+    // Spawning and Random, run on the main thread through commands
+    void ShootProjectile(const Vector2& velocity);
+    void SpawnPillars(const Vector2& playerPos);
     
     int mHP;
     int mPhase;
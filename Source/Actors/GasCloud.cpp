@@ -10,12 +10,15 @@
 #include <SDL_image.h>
 
 static Texture* sGasTexture = nullptr;
+static ActorPool<GasCloud> sPool("GasCloud");
+
+GasCloud* GasCloud::Spawn(Game* game, const Vector2& direction)
+{
+    return sPool.Acquire(game, direction);
+}
 
 GasCloud::GasCloud(Game* game, const Vector2& direction)
     : Actor(game)
-    , mDirection(direction)
-    , mLifeTime(1.0f)
-    , mSpeed(400.0f)
 {
     mSprite = new SpriteComponent(this, 150);
 
@@ -103,6 +106,22 @@ GasCloud::GasCloud(Game* game, const Vector2& direction)
         mSprite->SetTexture(sGasTexture);
     }
 
+    // RigidBody for movement and collision detection
+    mRigidBody = new RigidBodyComponent(this, 1.0f, 0.0f, false);
+
+    // Collider for precise collision (Trigger to pass through enemies)
+    mCollider = new AABBColliderComponent(this, 0, 0, 20, 20, ColliderLayer::PlayerProjectile, true);
+
+    Reset(direction);
+}
+
+void GasCloud::Reset(const Vector2& direction)
+{
+    mDirection = direction;
+    mLifeTime = 1.0f;
+    mSpeed = 400.0f;
+    mHitActors.clear();
+
     // Set 30% opacity
     mSprite->SetAlpha(0.3f);
     // Set Green Color
@@ -115,12 +134,7 @@ GasCloud::GasCloud(Game* game, const Vector2& direction)
     float scale = Random::GetFloatRange(0.1f, 0.3f);
     SetScale(Vector2(scale, scale));
 
-    // RigidBody for movement and collision detection
-    auto* rb = new RigidBodyComponent(this, 1.0f, 0.0f, false);
-    rb->SetVelocity(mDirection * mSpeed);
-
-    // Collider for precise collision (Trigger to pass through enemies)
-    mCollider = new AABBColliderComponent(this, 0, 0, 20, 20, ColliderLayer::PlayerProjectile, true);
+    mRigidBody->SetVelocity(mDirection * mSpeed);
 }
 
 void GasCloud::OnUpdate(float deltaTime)
@@ -159,9 +173,9 @@ void GasCloud::OnHorizontalCollision(const float minOverlap, AABBColliderCompone
         
         // Check if we already hit this enemy
         bool alreadyHit = false;
-        for (auto* hit : mHitActors)
+        for (const ActorHandle& hit : mHitActors)
         {
-            if (hit == enemy)
+            if (hit == enemy->GetHandle())
             {
                 alreadyHit = true;
                 break;
@@ -171,7 +185,7 @@ void GasCloud::OnHorizontalCollision(const float minOverlap, AABBColliderCompone
         if (!alreadyHit)
         {
             enemy->HitByGas();
-            mHitActors.push_back(enemy);
+            mHitActors.push_back(enemy->GetHandle());
         }
     }
     else if (other->GetLayer() == ColliderLayer::Blocks)
@@ -1,20 +1,30 @@
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 #include <vector>
 
 class GasCloud : public Actor
 {
 public:
-    GasCloud(class Game* game, const Vector2& direction);
+    // The alien gun fires one every 0.05 s, so they are pooled
+    static GasCloud* Spawn(class Game* game, const Vector2& direction);
+
     void OnUpdate(float deltaTime) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void OnVerticalCollision(const float minOverlap, class AABBColliderComponent* other) override;
 
 private:
+    friend class ActorPool<GasCloud>;
+
+    GasCloud(class Game* game, const Vector2& direction);
+    void Reset(const Vector2& direction);
+
     class SpriteComponent* mSprite;
     class AABBColliderComponent* mCollider;
+    class RigidBodyComponent* mRigidBody;
     Vector2 mDirection;
     float mLifeTime;
     float mSpeed;
-    std::vector<class Actor*> mHitActors;
+    // Handles, not pointers: a new actor reusing a dead one's address isn't "already hit"
+    std::vector<ActorHandle> mHitActors;
 };
@@ -5,6 +5,7 @@
 #include "Goomba.h"
 #include "Mushroom.h"
 #include "../Game.h"
+#include "../Random.h"
 #include "../Components/Drawing/AnimatorComponent.h"
 #include "../Components/Physics/RigidBodyComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
@@ -65,7 +66,7 @@ void Goomba::Kill()
 
         auto* rbc = GetComponent<RigidBodyComponent>();
         if (rbc) {
-            float horizontalVelocity = (rand() % 2 == 0) ? 150.0f : -150.0f;
+            float horizontalVelocity = (Random::GetIntRange(0, 1) == 0) ? 150.0f : -150.0f;
             rbc->SetVelocity(Vector2(horizontalVelocity, -350.0f));
         }
 
@@ -82,7 +83,7 @@ void Goomba::OnUpdate(float deltaTime)
         if (mStomped) { // countdown to destroy
             mDyingTimer -= deltaTime;
             if (mDyingTimer <= 0.0f) {
-                mState = ActorState::Destroy;
+                SetState(ActorState::Destroy);
             }
         }
     }
@@ -95,7 +96,7 @@ void Goomba::OnUpdate(float deltaTime)
 
     // Destroy if it falls off the bottom of the window
     if (mPosition.y > Game::WINDOW_HEIGHT + Game::TILE_SIZE) {
-        mState = ActorState::Destroy;
+        SetState(ActorState::Destroy);
     }
 }
 
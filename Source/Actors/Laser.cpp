@@ -3,6 +3,7 @@
 #include "../Components/Drawing/RectComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
 #include "../Components/Physics/RigidBodyComponent.h"
+#include "../Physics/SpatialHashGrid.h"
 #include <algorithm>
 
 namespace {
@@ -88,7 +89,11 @@ void Laser::UpdateBeam(const Vector2& start, const Vector2& direction)
 
     // Raycast against enemies
     Vector2 end = start + direction * length;
-    auto colliders = GetGame()->GetColliders();
+    Vector2 segMin(Math::Min(start.x, end.x), Math::Min(start.y, end.y));
+    Vector2 segMax(Math::Max(start.x, end.x), Math::Max(start.y, end.y));
+
+    auto colliders = GetGame()->GetFrameArena()->MakeVector<AABBColliderComponent*>();
+    GetGame()->GetCollisionGrid()->Query(segMin, segMax, colliders);
     for (auto collider : colliders) {
         if (collider->GetLayer() == ColliderLayer::Enemy && collider->IsEnabled()) {
             if (IntersectSegmentAABB(start, end, collider->GetMin(), collider->GetMax())) {
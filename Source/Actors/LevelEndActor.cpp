@@ -41,6 +41,8 @@ public:
                         Vector2(1.0f, 1.0f) // Scale normal (sem flip)
                     );
 
+                    // O quad ainda está no sprite batch: desenha antes de liberar a textura
+                    renderer->FlushSpriteBatch();
                     delete textTex; // Limpa textura temporária
                 }
             }
@@ -10,14 +10,19 @@
 #include "../Components/Physics/RigidBodyComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
 
+namespace
+{
+    ActorPool<Mushroom> sPool("Mushroom");
+}
+
+Mushroom* Mushroom::Spawn(Game* game)
+{
+    return sPool.Acquire(game);
+}
+
 Mushroom::Mushroom(Game* game)
     : Actor(game)
-    , mForwardSpeed(200.0f)
-    , mIsSpawning(true)
-    , mSpawnStartPosition(Vector2::Zero)
 {
-    GetGame()->GetAudio()->PlaySound("Mushroom.wav");
-    
     // Set up animator component
     auto* ac = new AnimatorComponent(this,
                                      "../Assets/Sprites/Collectables/Collectables.png",
@@ -30,12 +35,25 @@ Mushroom::Mushroom(Game* game)
     ac->SetAnimFPS(1.0f);
     
     // Set up physics components
-    auto* rbc = new RigidBodyComponent(this);
-    rbc->SetEnabled(false);
+    new RigidBodyComponent(this);
+
+    // Set up collider component
+    new AABBColliderComponent(this, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Collectable);
+
+    Reset();
+}
+
+void Mushroom::Reset()
+{
+    GetGame()->GetAudio()->PlaySound("Mushroom.wav");
+
+    mForwardSpeed = 200.0f;
+    mIsSpawning = true;
+    mSpawnStartPosition = Vector2::Zero;
 
-    // Set up collider component and disable it while spawning
-    auto* collider = new AABBColliderComponent(this, 0, 0, Game::TILE_SIZE, Game::TILE_SIZE, ColliderLayer::Collectable);
-    collider->SetEnabled(false);
+    // Physics and collider stay off while spawning
+    GetComponent<RigidBodyComponent>()->SetEnabled(false);
+    GetComponent<AABBColliderComponent>()->SetEnabled(false);
 }
 
 void Mushroom::OnUpdate(float deltaTime)
@@ -79,7 +97,7 @@ void Mushroom::OnUpdate(float deltaTime)
             pos.x + halfW < 0.0f ||
             pos.x - halfW > (Game::LEVEL_WIDTH * Game::TILE_SIZE))
         {
-            mState = ActorState::Destroy;
+            SetState(ActorState::Destroy);
         }
     }
 }
@@ -101,11 +119,11 @@ void Mushroom::OnVerticalCollision(const float minOverlap, AABBColliderComponent
         if (player) {
             player->PowerUp();
         }
-        mState = ActorState::Destroy;
+        SetState(ActorState::Destroy);
     }
 }
 
 void Mushroom::Kill()
 {
-    mState = ActorState::Destroy;
+    SetState(ActorState::Destroy);
 }
\ No newline at end of file
@@ -4,11 +4,12 @@
 
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 
 class Mushroom : public Actor
 {
 public:
-    Mushroom(class Game* game);
+    static Mushroom* Spawn(class Game* game);
 
     void OnUpdate(float deltaTime) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
@@ -16,6 +17,11 @@ public:
     void Kill() override;
 
 private:
+    friend class ActorPool<Mushroom>;
+
+    Mushroom(class Game* game);
+    void Reset();
+
     float mForwardSpeed;
     bool mIsSpawning;
     Vector2 mSpawnStartPosition;
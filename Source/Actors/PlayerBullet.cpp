@@ -47,7 +47,7 @@ void PlayerBullet::OnUpdate(float deltaTime)
 
 void PlayerBullet::Explode()
 {
-    mState = ActorState::Destroy;
+    SetState(ActorState::Destroy);
 }
 
 void PlayerBullet::OnHorizontalCollision(const float /*minOverlap*/, AABBColliderComponent* other)
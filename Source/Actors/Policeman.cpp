@@ -1,4 +1,5 @@
 #include "Policeman.h"
+#include "ActorCommands.h"
 #include "PolicemanBullet.h"
 #include "Spaceman.h"
 #include "../Game.h"
@@ -73,14 +74,16 @@ Policeman::Policeman(Game* game, float forwardSpeed)
 
     mRigidBodyComponent = new RigidBodyComponent(this);
     mColliderComponent = new AABBColliderComponent(this, 0, 2, 30, 60, ColliderLayer::Enemy);
+
+    EnableThink();
 }
 
-void Policeman::OnUpdate(float deltaTime)
+void Policeman::OnThink(float deltaTime, ActorCommands& commands)
 {
     if (mIsDying) {
         mDyingTimer -= deltaTime;
         if (mDyingTimer <= 0.0f) {
-            SetState(ActorState::Destroy);
+            commands.Destroy(this);
         }
         return;
     }
@@ -94,17 +97,17 @@ void Policeman::OnUpdate(float deltaTime)
         if (dist < 400.0f) { // Detection distance
             mIsAggressive = true;
             mAIState = AIState::Aggressive;
-            GetGame()->GetAudio()->PlaySound("Confused.wav");
-            GetGame()->AddFloatingText(mPosition, "Parado!", 2.0f, this);
+            commands.PlaySound("Confused.wav");
+            commands.AddFloatingText(mPosition, "Parado!", 2.0f, this);
         } else {
             UpdateIdle(deltaTime);
         }
     } else {
-        UpdateAggressive(deltaTime);
+        UpdateAggressive(deltaTime, commands);
     }
     
     if (mPosition.y > Game::WINDOW_HEIGHT + Game::TILE_SIZE) {
-        SetState(ActorState::Destroy);
+        commands.Destroy(this);
     }
 }
 
@@ -127,7 +130,7 @@ void Policeman::UpdateIdle(float deltaTime)
     }
 }
 
-void Policeman::UpdateAggressive(float deltaTime)
+void Policeman::UpdateAggressive(float deltaTime, ActorCommands& commands)
 {
     const Spaceman* player = GetGame()->GetPlayer();
     if (!player) return;
@@ -151,7 +154,7 @@ void Policeman::UpdateAggressive(float deltaTime)
         mAnimatorComponent->SetAnimation("shoot");
         mRigidBodyComponent->SetVelocity(Vector2::Zero);
         if (mShootTimer <= 0.0f) {
-            Shoot(dir);
+            Shoot(dir, commands);
             mShootTimer = mShootCooldown;
         }
     } else { // Chase
@@ -160,11 +163,16 @@ void Policeman::UpdateAggressive(float deltaTime)
     }
 }
 
-void Policeman::Shoot(const Vector2& direction)
+void Policeman::Shoot(const Vector2& direction, ActorCommands& commands)
 {
-    GetGame()->GetAudio()->PlaySound("Shoot.wav");
-    auto* bullet = new PolicemanBullet(GetGame(), direction, this);
-    bullet->SetPosition(mPosition + direction * 40.0f);
+    commands.PlaySound("Shoot.wav");
+
+    // Spawning adds an actor, so it waits for the main thread
+    Vector2 position = mPosition + direction * 40.0f;
+    commands.Defer([this, direction, position]() {
+        auto* bullet = PolicemanBullet::Spawn(GetGame(), direction, this);
+        bullet->SetPosition(position);
+    });
 }
 
 void Policeman::Kill()
@@ -5,7 +5,7 @@ class Policeman : public Actor
 {
 public:
     Policeman(class Game* game, float forwardSpeed = 100.0f);
-    void OnUpdate(float deltaTime) override;
+    void OnThink(float deltaTime, class ActorCommands& commands) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void OnVerticalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void Kill() override;
@@ -37,6 +37,6 @@ private:
     class AnimatorComponent* mAnimatorComponent;
     
     void UpdateIdle(float deltaTime);
-    void UpdateAggressive(float deltaTime);
-    void Shoot(const Vector2& direction);
+    void UpdateAggressive(float deltaTime, class ActorCommands& commands);
+    void Shoot(const Vector2& direction, class ActorCommands& commands);
 };
@@ -4,19 +4,35 @@
 #include "../Components/Physics/RigidBodyComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
 
+namespace
+{
+    ActorPool<PolicemanBullet> sPool("PolicemanBullet");
+}
+
+PolicemanBullet* PolicemanBullet::Spawn(Game* game, const Vector2& direction, Actor* shooter)
+{
+    return sPool.Acquire(game, direction, shooter);
+}
+
 PolicemanBullet::PolicemanBullet(Game* game, const Vector2& direction, Actor* shooter)
     : Actor(game)
-    , mLifeTime(2.0f)
-    , mShooter(shooter)
 {
     mRectComponent = new RectComponent(this, 10, 10, RendererMode::TRIANGLES, 200);
     mRectComponent->SetColor(Vector3(1.0f, 0.0f, 0.0f)); // Red bullet
 
     mRigidBodyComponent = new RigidBodyComponent(this, 0.0f, 0.0f, false); // No gravity
-    mRigidBodyComponent->SetVelocity(direction * 400.0f); 
 
     // Use Enemy layer so it kills player on contact (Player checks collision with Enemy layer)
     mColliderComponent = new AABBColliderComponent(this, 0, 0, 10, 10, ColliderLayer::Enemy, true);
+
+    Reset(direction, shooter);
+}
+
+void PolicemanBullet::Reset(const Vector2& direction, Actor* shooter)
+{
+    mLifeTime = 2.0f;
+    mShooter = shooter;
+    mRigidBodyComponent->SetVelocity(direction * 400.0f);
 }
 
 void PolicemanBullet::OnUpdate(float deltaTime)
@@ -1,5 +1,7 @@
 #include "RobotFlyer.h"
+#include "ActorCommands.h"
 #include "../Game.h"
+#include "../Random.h"
 #include "Spaceman.h"
 #include "../Components/Drawing/SpriteComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
@@ -37,7 +39,6 @@ RobotFlyer::RobotFlyer(Game* game)
     "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.json",
         20, 
         100, 
-        ColliderLayer::EnemyProjectile,
         false, // No gravity
         0.25f,  // Small collider (32 * 0.25 = 8px)
         Vector2(8.0f, 8.0f) // Shift sprite to bottom-right to center the visual bullet
@@ -49,7 +50,6 @@ RobotFlyer::RobotFlyer(Game* game)
         "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.json",
         20, 
         100, 
-        ColliderLayer::EnemyProjectile,
         true, // Gravity enabled for debris
         0.5f,
         Vector2(16.0f, 16.0f) // Shift for 64x64
@@ -69,6 +69,9 @@ RobotFlyer::RobotFlyer(Game* game)
     PickNewOffset();
 
     sFlyers.push_back(this);
+
+    // Flocking só lê a posição dos outros, que fica congelada durante o OnThink
+    EnableThink();
 }
 
 RobotFlyer::~RobotFlyer()
@@ -80,7 +83,7 @@ RobotFlyer::~RobotFlyer()
     }
 }
 
-void RobotFlyer::OnUpdate(float deltaTime)
+void RobotFlyer::OnThink(float deltaTime, ActorCommands& commands)
 {
     if (mIsArriving) {
         Vector2 currentPos = GetPosition();
@@ -94,7 +97,7 @@ void RobotFlyer::OnUpdate(float deltaTime)
             mIsArriving = false;
         } else {
             diff.Normalize();
-            SetPosition(currentPos + diff * mArrivalSpeed * deltaTime);
+            commands.SetPosition(this, currentPos + diff * mArrivalSpeed * deltaTime);
         }
 
         return;
@@ -123,7 +126,7 @@ void RobotFlyer::OnUpdate(float deltaTime)
         if (distSq < mActivationRange * mActivationRange)
         {
             mHasActivated = true;
-            GetGame()->GetAudio()->PlaySound("DroneActive.wav");
+            commands.PlaySound("DroneActive.wav");
             // Opcional: Tocar um som de "Drone ativando" aqui
         }
         else
@@ -137,7 +140,8 @@ void RobotFlyer::OnUpdate(float deltaTime)
     // 1. Timer do movimento aleatório
     mMoveTimer -= deltaTime;
     if (mMoveTimer <= 0.0f) {
-        PickNewOffset();
+        // Random é compartilhado: sorteia na thread principal, na ordem dos atores
+        commands.Defer([this]() { PickNewOffset(); });
     }
 
     mHoverTimer += deltaTime;
@@ -220,7 +224,7 @@ void RobotFlyer::OnUpdate(float deltaTime)
     // Lerp suave towards adjusted target
     Vector2 smoothMove = myPos + (flockAdjustedTarget - myPos) * mSmoothFactor * deltaTime;
     
-    SetPosition(smoothMove);
+    commands.SetPosition(this, smoothMove);
 
     // Virar sprite (Olhar para o player)
     if (targetX < myPos.x) SetScale(Vector2(1, 1));
@@ -237,8 +241,11 @@ void RobotFlyer::OnUpdate(float deltaTime)
     // Só atira se estiver perto horizontalmente (não atira se estiver muito longe na tela)
     if (player->GetPosture() != PlayerPosture::Crouching && abs(diff.x) < 500.0f) {
         if (mShootCooldown <= 0.0f) {
-            Shoot();
-            mShootCooldown = 2.0f + (rand() % 100) / 100.0f;
+            // Partículas e Random também, depois do SetPosition acima
+            commands.Defer([this]() {
+                Shoot();
+                mShootCooldown = 2.0f + Random::GetIntRange(0, 99) / 100.0f;
+            });
         }
     }
 }
@@ -246,16 +253,16 @@ void RobotFlyer::OnUpdate(float deltaTime)
 void RobotFlyer::PickNewOffset()
 {
     // A cada 2 ou 3 segundos, mudamos o ponto de destino
-    mMoveTimer = 2.0f + (rand() % 100) / 50.0f;
+    mMoveTimer = 2.0f + Random::GetIntRange(0, 99) / 50.0f;
 
     // REGRAS DE POSICIONAMENTO:
     // Altura: Entre 100 e 200 pixels ACIMA do player (Y negativo é pra cima)
-    float randomY = -100.0f - (rand() % 100); 
+    float randomY = -100.0f - Random::GetIntRange(0, 99); 
 
     // Distância: Entre 150 e 250 pixels de distância horizontal
     // Vamos decidir aleatoriamente se ficamos na esquerda ou direita
-    float side = (rand() % 2 == 0) ? 1.0f : -1.0f;
-    float randomX = (150.0f + (rand() % 100)) * side;
+    float side = (Random::GetIntRange(0, 1) == 0) ? 1.0f : -1.0f;
+    float randomX = (150.0f + Random::GetIntRange(0, 99)) * side;
 
     mCurrentOffset = Vector2(randomX, randomY);
 }
@@ -287,12 +294,12 @@ void RobotFlyer::Kill()
     // Efeito de explosão
     for (int i = 0; i < 30; i++) {
         // Random direction
-        float angle = (rand() % 360) * (3.14159f / 180.0f);
-        float speed = 150.0f + (rand() % 250);
+        float angle = Random::GetIntRange(0, 359) * (3.14159f / 180.0f);
+        float speed = 150.0f + Random::GetIntRange(0, 249);
         Vector2 dir(cos(angle), sin(angle));
         
         // Random lifetime for "fade out" effect (staggered disappearance)
-        float lifetime = 0.5f + (rand() % 150) / 100.0f; // 0.5 to 2.0 seconds
+        float lifetime = 0.5f + Random::GetIntRange(0, 149) / 100.0f; // 0.5 to 2.0 seconds
 
         mExplosionParticleSystem->EmitParticle(lifetime, speed, dir);
     }
@@ -305,7 +312,7 @@ void RobotFlyer::SetArrival(const Vector2& targetPos)
     mIsArriving = true;
     mTargetPos = targetPos;
 
-    float randomOffsetX = static_cast<float>(rand() % 200 - 100);
+    float randomOffsetX = static_cast<float>(Random::GetIntRange(0, 199) - 100);
 
     Vector2 startPos;
     startPos.x = targetPos.x + randomOffsetX;
@@ -6,7 +6,7 @@ class RobotFlyer : public Actor
 public:
     RobotFlyer(class Game* game);
     ~RobotFlyer();
-    void OnUpdate(float deltaTime) override;
+    void OnThink(float deltaTime, class ActorCommands& commands) override;
     void Kill() override;
     void SetArrival(const Vector2& targetPos);
 
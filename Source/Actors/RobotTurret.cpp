@@ -1,6 +1,7 @@
 #include "RobotTurret.h"
 #include "EnemyLaser.h"
 #include "../Game.h"
+#include "../Random.h"
 #include "Spaceman.h" // Para saber onde o player está
 #include "../Components/ParticleSystemComponent.h"
 #include "../Components/Drawing/SpriteComponent.h"
@@ -25,8 +26,7 @@ RobotTurret::RobotTurret(Game* game)
     "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.png",
         "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.json",
     20,
-    100,
-    ColliderLayer::EnemyProjectile
+    100
 );
 
     mExplosionParticleSystem = new ParticleSystemComponent(this, 
@@ -35,7 +35,6 @@ RobotTurret::RobotTurret(Game* game)
         "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.json",
         20, 
         100, 
-        ColliderLayer::EnemyProjectile,
         false, // Gravity disabled for debris
         0.5f,
         Vector2(16.0f, 16.0f) // Shift for 64x64
@@ -130,12 +129,12 @@ void RobotTurret::Explode() {
     // Lança partículas em todas as direções usando o sistema que já temos
     for (int i = 0; i < 30; i++) {
         // Random direction
-        float angle = (rand() % 360) * (3.14159f / 180.0f);
-        float speed = 150.0f + (rand() % 250);
+        float angle = Random::GetIntRange(0, 359) * (3.14159f / 180.0f);
+        float speed = 150.0f + Random::GetIntRange(0, 249);
         Vector2 dir(cos(angle), sin(angle));
         
         // Random lifetime for "fade out" effect (staggered disappearance)
-        float lifetime = 0.5f + (rand() % 150) / 100.0f; // 0.5 to 2.0 seconds
+        float lifetime = 0.5f + Random::GetIntRange(0, 149) / 100.0f; // 0.5 to 2.0 seconds
 
         mExplosionParticleSystem->EmitParticle(lifetime, speed, dir);
     }
@@ -1,4 +1,5 @@
 #include "Soldier.h"
+#include "ActorCommands.h"
 #include "SoldierBullet.h"
 #include "Spaceman.h"
 #include "../Game.h"
@@ -48,14 +49,16 @@ Soldier::Soldier(Game* game)
 
     mRigidBodyComponent = new RigidBodyComponent(this);
     mColliderComponent = new AABBColliderComponent(this, 0, -8, 40, 80, ColliderLayer::Enemy);
+
+    EnableThink();
 }
 
-void Soldier::OnUpdate(float deltaTime)
+void Soldier::OnThink(float deltaTime, ActorCommands& commands)
 {
     if (mIsDying) {
         mDyingTimer -= deltaTime;
         if (mDyingTimer <= 0.0f) {
-            SetState(ActorState::Destroy);
+            commands.Destroy(this);
         }
         return;
     }
@@ -78,8 +81,8 @@ void Soldier::OnUpdate(float deltaTime)
         
         if (dist < 400.0f) {
             mState = State::Attacking;
-            GetGame()->GetAudio()->PlaySound("Confused.wav");
-            GetGame()->AddFloatingText(mPosition, "Alien encontrado, exterminar", 2.0f, this);
+            commands.PlaySound("Confused.wav");
+            commands.AddFloatingText(mPosition, "Alien encontrado, exterminar", 2.0f, this);
             mShotsFired = 0;
             mCurrentAnimTime = 0.0f;
             mShotTimer = 0.0f;
@@ -94,7 +97,7 @@ void Soldier::OnUpdate(float deltaTime)
         if (mShotsFired < 3) {
             mShotTimer -= deltaTime;
             if (mShotTimer <= 0.0f) {
-                Shoot(dir);
+                Shoot(dir, commands);
                 mShotsFired++;
                 // Distribute shots evenly across animation
                 mShotTimer = mAnimationDuration / 3.5f; 
@@ -116,15 +119,19 @@ void Soldier::OnUpdate(float deltaTime)
     }
     
     if (mPosition.y > Game::WINDOW_HEIGHT + Game::TILE_SIZE) {
-        SetState(ActorState::Destroy);
+        commands.Destroy(this);
     }
 }
 
-void Soldier::Shoot(const Vector2& direction)
+void Soldier::Shoot(const Vector2& direction, ActorCommands& commands)
 {
-    GetGame()->GetAudio()->PlaySound("Continuousshooting.wav");
-    auto* bullet = new SoldierBullet(GetGame(), direction, this);
-    bullet->SetPosition(mPosition + direction * 40.0f);
+    commands.PlaySound("Continuousshooting.wav");
+
+    Vector2 position = mPosition + direction * 40.0f;
+    commands.Defer([this, direction, position]() {
+        auto* bullet = SoldierBullet::Spawn(GetGame(), direction, this);
+        bullet->SetPosition(position);
+    });
 }
 
 void Soldier::Kill()
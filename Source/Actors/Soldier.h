@@ -5,7 +5,7 @@ class Soldier : public Actor
 {
 public:
     Soldier(class Game* game);
-    void OnUpdate(float deltaTime) override;
+    void OnThink(float deltaTime, class ActorCommands& commands) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void OnVerticalCollision(const float minOverlap, class AABBColliderComponent* other) override;
     void Kill() override;
@@ -29,5 +29,5 @@ private:
     class AABBColliderComponent* mColliderComponent;
     class AnimatorComponent* mAnimatorComponent;
 
-    void Shoot(const Vector2& direction);
+    void Shoot(const Vector2& direction, class ActorCommands& commands);
 };
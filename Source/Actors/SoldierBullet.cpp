@@ -4,10 +4,18 @@
 #include "../Components/Physics/RigidBodyComponent.h"
 #include "../Components/Physics/AABBColliderComponent.h"
 
+namespace
+{
+    ActorPool<SoldierBullet> sPool("SoldierBullet");
+}
+
+SoldierBullet* SoldierBullet::Spawn(Game* game, const Vector2& direction, Actor* shooter)
+{
+    return sPool.Acquire(game, direction, shooter);
+}
+
 SoldierBullet::SoldierBullet(Game* game, const Vector2& direction, Actor* shooter)
     : Actor(game)
-    , mLifeTime(3.0f)
-    , mShooter(shooter)
 {
     mAnimatorComponent = new AnimatorComponent(this, 
         "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.png",
@@ -26,10 +34,18 @@ SoldierBullet::SoldierBullet(Game* game, const Vector2& direction, Actor* shoote
     mAnimatorComponent->SetSize(48.0f, 48.0f);
 
     mRigidBodyComponent = new RigidBodyComponent(this, 0.0f, 0.0f, false); // No gravity
-    mRigidBodyComponent->SetVelocity(direction * 400.0f); 
 
     // Use Enemy layer so it kills player on contact
     mColliderComponent = new AABBColliderComponent(this, 0, 0, 12, 12, ColliderLayer::Enemy, true);
+
+    Reset(direction, shooter);
+}
+
+void SoldierBullet::Reset(const Vector2& direction, Actor* shooter)
+{
+    mLifeTime = 3.0f;
+    mShooter = shooter;
+    mRigidBodyComponent->SetVelocity(direction * 400.0f);
 }
 
 void SoldierBullet::OnUpdate(float deltaTime)
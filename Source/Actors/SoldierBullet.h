@@ -1,16 +1,23 @@
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 
 class SoldierBullet : public Actor
 {
 public:
-    SoldierBullet(class Game* game, const Vector2& direction, Actor* shooter = nullptr);
+    static SoldierBullet* Spawn(class Game* game, const Vector2& direction, Actor* shooter = nullptr);
+
     void OnUpdate(float deltaTime) override;
     void OnHorizontalCollision(const float minOverlap, class AABBColliderComponent* other) override;
 
     Actor* GetShooter() const { return mShooter; }
 
 private:
+    friend class ActorPool<SoldierBullet>;
+
+    SoldierBullet(class Game* game, const Vector2& direction, Actor* shooter);
+    void Reset(const Vector2& direction, Actor* shooter);
+
     float mLifeTime;
     Actor* mShooter;
     class AnimatorComponent* mAnimatorComponent;
@@ -103,7 +103,6 @@ Spaceman::Spaceman(Game* game)
         "../Assets/Sprites/ObjectsScenery-ContraDiction/bulletparticle.json",
         20,
         10,
-        ColliderLayer::PlayerProjectile,
         false, // No gravity
         0.25f, // Small collider (48 * 0.25 = 12px)
         Vector2(12.0f, 12.0f) // Shift sprite to bottom-right (scaled for 48x48)
@@ -313,7 +312,7 @@ void Spaceman::OnProcessInput(const Uint8* state)
     
     // Arm Rotation & Shooting
     int mouseX, mouseY;
-    Uint32 mouseButtons = SDL_GetMouseState(&mouseX, &mouseY);
+    Uint32 mouseButtons = GetGame()->GetMouseState(&mouseX, &mouseY);
     Vector2 mousePos(static_cast<float>(mouseX), static_cast<float>(mouseY));
     
     Vector2 aimDir = Vector2::Zero;
@@ -682,7 +681,7 @@ void Spaceman::ManageAnimations()
     }
 
     if (mIsRunning) {
-        const Uint8* state = SDL_GetKeyboardState(nullptr);
+        const Uint8* state = GetGame()->GetKeyState();
         if (usePeace && (state[SDL_SCANCODE_LSHIFT] || state[SDL_SCANCODE_RSHIFT])) {
             activeAnim->SetAnimation("dash", 0.0f);
         } else {
@@ -722,7 +721,7 @@ void Spaceman::TryShoot()
         
         Vector2 spreadDir(Math::Cos(finalAngle), Math::Sin(finalAngle));
         
-        GasCloud* gas = new GasCloud(GetGame(), spreadDir);
+        GasCloud* gas = GasCloud::Spawn(GetGame(), spreadDir);
         gas->SetPosition(spawnPos);
         
         // Play sound occasionally or loop?
@@ -888,6 +887,11 @@ void Spaceman::OnVerticalCollision(const float minOverlap, AABBColliderComponent
             GetGame()->GetAudio()->PlaySound("Bump.wav");
             block->Bump();
         }
+        else
+        {
+            // Terreno do tilemap: não há bloco para animar, só o som
+            GetGame()->GetAudio()->PlaySound("Bump.wav");
+        }
     }
 }
 
@@ -58,7 +58,7 @@ private:
     ItemType mHandItem;
 
     // Gas Logic
-    std::map<class Actor*, float> mGasExposureTimers;
+    std::map<ActorHandle, float> mGasExposureTimers;
 
     float mMoveForce;
     float mJumpImpulse;
@@ -4,6 +4,7 @@
 
 #include "Spawner.h"
 #include "../Game.h"
+#include "../Random.h"
 #include "Spaceman.h"
 #include "Policeman.h"
 #include "AlienKid.h"
@@ -47,12 +48,12 @@ void Spawner::OnUpdate(float deltaTime)
                     break;
                 case SpawnerType::RobotFlyer:
                 {
-                    int count = 4 + (rand() % 2);
+                    int count = 4 + Random::GetIntRange(0, 1);
                     for(int i=0; i<count; ++i) {
                         auto* flyer = new RobotFlyer(GetGame());
                         // Random offset around spawner position
-                        float offX = (rand() % 60) - 30.0f;
-                        float offY = (rand() % 60) - 30.0f;
+                        float offX = Random::GetIntRange(0, 59) - 30.0f;
+                        float offY = Random::GetIntRange(0, 59) - 30.0f;
                         Vector2 spawnPos = mPosition + Vector2(offX, offY);
                         
                         flyer->SetPosition(spawnPos);
@@ -75,7 +76,7 @@ void Spawner::OnUpdate(float deltaTime)
                     }
                 }
             }
-            mState = ActorState::Destroy;
+            SetState(ActorState::Destroy);
         }
     }
 }
\ No newline at end of file
@@ -4,10 +4,18 @@
 #include "../Components/Physics/AABBColliderComponent.h"
 #include "Spaceman.h"
 
+namespace
+{
+    ActorPool<Vine> sPool("Vine");
+}
+
+Vine* Vine::Spawn(Game* game)
+{
+    return sPool.Acquire(game);
+}
+
 Vine::Vine(Game* game)
     :Actor(game)
-    ,mLifeTime(2.0f)
-    ,mSpeed(300.0f)
 {
     SpriteComponent* sc = new SpriteComponent(this);
     // Using BlockA.png as placeholder
@@ -16,6 +24,14 @@ Vine::Vine(Game* game)
     
     // Collider
     mBox = new AABBColliderComponent(this, 0, 0, 32, 32, ColliderLayer::EnemyProjectile);
+
+    Reset();
+}
+
+void Vine::Reset()
+{
+    mLifeTime = 2.0f;
+    mSpeed = 300.0f;
 }
 
 void Vine::OnUpdate(float deltaTime)
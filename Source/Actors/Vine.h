@@ -1,14 +1,21 @@
 #pragma once
 #include "Actor.h"
+#include "ActorPool.h"
 
 class Vine : public Actor
 {
 public:
-    Vine(class Game* game);
+    static Vine* Spawn(class Game* game);
+
     void OnUpdate(float deltaTime) override;
     void OnHorizontalCollision(float overlap, class AABBColliderComponent* other) override;
     void OnVerticalCollision(float overlap, class AABBColliderComponent* other) override;
 private:
+    friend class ActorPool<Vine>;
+
+    Vine(class Game* game);
+    void Reset();
+
     class AABBColliderComponent* mBox;
     float mLifeTime;
     float mSpeed;
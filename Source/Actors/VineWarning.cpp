@@ -17,7 +17,7 @@ void VineWarning::OnUpdate(float deltaTime)
     mLifeTime -= deltaTime;
     if (mLifeTime <= 0.0f) {
         // Spawn Vine
-        auto* vine = new Vine(GetGame());
+        auto* vine = Vine::Spawn(GetGame());
         vine->SetPosition(GetPosition());
         
         SetState(ActorState::Destroy);
@@ -2,6 +2,7 @@
 #include "SDL.h"
 #include "SDL_mixer.h"
 #include <filesystem>
+#include "Profiler.h"
 
 SoundHandle SoundHandle::Invalid;
 
@@ -14,9 +15,31 @@ AudioSystem::AudioSystem(int numChannels)
     mChannels.resize(numChannels);
 }
 
+AudioSystem::AudioSystem(NoDevice)
+    : mHasDevice(false)
+{
+}
+
 // Destroy the AudioSystem
 AudioSystem::~AudioSystem()
 {
+    if (!mHasDevice)
+    {
+        return;
+    }
+
+    Mix_HaltMusic();
+    if (mMusic)
+    {
+        Mix_FreeMusic(mMusic);
+        mMusic = nullptr;
+    }
+    if (mPendingMusic)
+    {
+        Mix_FreeMusic(mPendingMusic);
+        mPendingMusic = nullptr;
+    }
+
     for (auto& sound : mSounds)
     {
         Mix_FreeChunk(sound.second);
@@ -26,9 +49,24 @@ AudioSystem::~AudioSystem()
     Mix_CloseAudio();
 }
 
+int AudioSystem::GetActiveChannelCount() const
+{
+    int count = 0;
+    for (const auto& channel : mChannels)
+    {
+        if (channel.IsValid())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
 // Updates the status of all the active sounds every frame
 void AudioSystem::Update(float deltaTime)
 {
+    PROFILE_SCOPE("AudioSystem::Update");
+
     for(int i = 0; i < mChannels.size(); i++)
     {
         if(mChannels[i].IsValid())
@@ -39,6 +77,8 @@ void AudioSystem::Update(float deltaTime)
             }
         }
     }
+
+    UpdateMusic();
 }
 
 // Plays the sound with the specified name and loops if looping is true
@@ -150,6 +190,160 @@ SoundHandle AudioSystem::PlaySound(const std::string& soundName, bool looping, S
     return mLastHandle;
 }
 
+// Streams a looping music track. Mix_Music decodes as it plays, so nothing
+// but the file header is read here.
+SoundHandle AudioSystem::PlayMusic(const std::string& musicName, float fadeSeconds)
+{
+    std::string fileName = "../Assets/Sounds/";
+    fileName += musicName;
+
+    Mix_Music* music = Mix_LoadMUS(fileName.c_str());
+    if (!music)
+    {
+        SDL_Log("[AudioSystem] Failed to open music file %s: %s", fileName.c_str(), Mix_GetError());
+        return SoundHandle::Invalid;
+    }
+
+    // A track still waiting for its turn is simply replaced
+    if (mPendingMusic)
+    {
+        mHandleMap.erase(mPendingMusicHandle);
+        mPendingMusicHandle.Reset();
+        Mix_FreeMusic(mPendingMusic);
+        mPendingMusic = nullptr;
+    }
+
+    // The old track is over for the caller even while it fades out
+    if (mMusicHandle.IsValid())
+    {
+        mHandleMap.erase(mMusicHandle);
+        mMusicHandle.Reset();
+    }
+
+    ++mLastHandle;
+
+    HandleInfo info;
+    info.mSoundName = musicName;
+    info.mIsLooping = true;
+    info.mIsMusic = true;
+    info.mCategory = SoundCategory::Music;
+    mHandleMap.emplace(mLastHandle, info);
+
+    mPendingMusic = music;
+    mPendingMusicHandle = mLastHandle;
+    mMusicFadeMs = static_cast<int>(fadeSeconds * 1000.0f);
+
+    if (Mix_PlayingMusic())
+    {
+        // Paused music never advances its fade, so cut it instead
+        if (mMusicFadeMs > 0 && !Mix_PausedMusic())
+        {
+            if (Mix_FadingMusic() != MIX_FADING_OUT)
+            {
+                Mix_FadeOutMusic(mMusicFadeMs);
+            }
+        }
+        else
+        {
+            Mix_HaltMusic();
+        }
+    }
+
+    // Starts right away when nothing is fading out
+    UpdateMusic();
+
+    return mLastHandle;
+}
+
+void AudioSystem::UpdateMusic()
+{
+    if (!mPendingMusic || Mix_PlayingMusic())
+    {
+        return;
+    }
+
+    if (mMusic)
+    {
+        Mix_FreeMusic(mMusic);
+    }
+
+    mMusic = mPendingMusic;
+    mMusicHandle = mPendingMusicHandle;
+    mPendingMusic = nullptr;
+    mPendingMusicHandle.Reset();
+
+    Mix_VolumeMusic(mMusicVolume);
+
+    int result = mMusicFadeMs > 0 ? Mix_FadeInMusic(mMusic, -1, mMusicFadeMs) : Mix_PlayMusic(mMusic, -1);
+    if (result == -1)
+    {
+        SDL_Log("[AudioSystem] Failed to play music: %s", Mix_GetError());
+        mHandleMap.erase(mMusicHandle);
+        mMusicHandle.Reset();
+        Mix_FreeMusic(mMusic);
+        mMusic = nullptr;
+        return;
+    }
+
+    // Paused before it got to play (e.g. a menu opened during the fade)
+    auto iter = mHandleMap.find(mMusicHandle);
+    if (iter != mHandleMap.end() && iter->second.mIsPaused)
+    {
+        Mix_PauseMusic();
+    }
+}
+
+void AudioSystem::PauseHandle(HandleInfo& info)
+{
+    if (info.mIsMusic)
+    {
+        // Also holds a fade-out in progress, so the next track waits too
+        Mix_PauseMusic();
+    }
+    else
+    {
+        Mix_Pause(info.mChannel);
+    }
+    info.mIsPaused = true;
+}
+
+void AudioSystem::ResumeHandle(HandleInfo& info)
+{
+    if (info.mIsMusic)
+    {
+        Mix_ResumeMusic();
+    }
+    else
+    {
+        Mix_Resume(info.mChannel);
+    }
+    info.mIsPaused = false;
+}
+
+void AudioSystem::HaltHandle(SoundHandle handle, HandleInfo& info)
+{
+    if (!info.mIsMusic)
+    {
+        Mix_HaltChannel(info.mChannel);
+        mChannels[info.mChannel].Reset();
+        return;
+    }
+
+    if (handle == mPendingMusicHandle)
+    {
+        Mix_FreeMusic(mPendingMusic);
+        mPendingMusic = nullptr;
+        mPendingMusicHandle.Reset();
+    }
+    else if (handle == mMusicHandle)
+    {
+        Mix_HaltMusic();
+        Mix_FreeMusic(mMusic);
+        mMusic = nullptr;
+        mMusicHandle.Reset();
+    }
+}
+
 void AudioSystem::SetBusVolume(SoundCategory category, int volume)
 {
     if (volume < 0) volume = 0;
@@ -158,9 +352,14 @@ void AudioSystem::SetBusVolume(SoundCategory category, int volume)
     if (category == SoundCategory::Music) mMusicVolume = volume;
     else mSFXVolume = volume;
 
+    if (category == SoundCategory::Music)
+    {
+        Mix_VolumeMusic(volume);
+    }
+
     for (auto& kv : mHandleMap)
     {
-        if (kv.second.mCategory == category)
+        if (kv.second.mCategory == category && !kv.second.mIsMusic)
         {
             Mix_Volume(kv.second.mChannel, volume);
         }
@@ -181,11 +380,8 @@ void AudioSystem::StopSound(SoundHandle sound)
         return;
     }
 
-    int channel = mHandleMap[sound].mChannel;
-
-    Mix_HaltChannel(channel);
+    HaltHandle(sound, mHandleMap[sound]);
     mHandleMap.erase(sound);
-    mChannels[channel].Reset();
 }
 
 // Pauses the sound if it is currently playing
@@ -199,8 +395,7 @@ void AudioSystem::PauseSound(SoundHandle sound)
 
     if(!mHandleMap[sound].mIsPaused)
     {
-        Mix_Pause(mHandleMap[sound].mChannel);
-        mHandleMap[sound].mIsPaused = true;
+        PauseHandle(mHandleMap[sound]);
     }
 }
 
@@ -215,8 +410,7 @@ void AudioSystem::ResumeSound(SoundHandle sound)
 
     if(mHandleMap[sound].mIsPaused)
     {
-        Mix_Resume(mHandleMap[sound].mChannel);
-        mHandleMap[sound].mIsPaused = false;
+        ResumeHandle(mHandleMap[sound]);
     }
 }
 
@@ -224,8 +418,7 @@ void AudioSystem::PauseAllSounds(SoundHandle exception)
 {
     for (auto& handle : mHandleMap) {
         if (handle.first != exception && !handle.second.mIsPaused) {
-            Mix_Pause(handle.second.mChannel);
-            handle.second.mIsPaused = true;
+            PauseHandle(handle.second);
         }
     }
 }
@@ -234,8 +427,7 @@ void AudioSystem::ResumeAllSounds(SoundHandle exception)
 {
     for (auto& handle : mHandleMap) {
         if (handle.first != exception && handle.second.mIsPaused) {
-            Mix_Resume(handle.second.mChannel);
-            handle.second.mIsPaused = false;
+            ResumeHandle(handle.second);
         }
     }
 }
@@ -267,8 +459,7 @@ void AudioSystem::StopAllSounds(SoundHandle exception)
             ++iter;
         }
         else {
-            Mix_HaltChannel(info.mChannel);
-            mChannels[info.mChannel].Reset();
+            HaltHandle(currentHandle, info);
             iter = mHandleMap.erase(iter);
         }
     }
@@ -358,6 +549,16 @@ void AudioSystem::ProcessInput(const Uint8* keyState)
                 }
             }
         }
+
+        if (mMusicHandle.IsValid())
+        {
+            auto iter = mHandleMap.find(mMusicHandle);
+            if (iter != mHandleMap.end())
+            {
+                SDL_Log("Music: %s, %s, paused = %d", mMusicHandle.GetDebugStr(),
+                        iter->second.mSoundName.c_str(), iter->second.mIsPaused);
+            }
+        }
     }
 
     mLastDebugKey = keyState[SDL_SCANCODE_PERIOD];
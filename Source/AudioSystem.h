@@ -73,10 +73,10 @@ public:
     // (Defaults to 8 channels)
     AudioSystem(int numChannels = 8);
     // Destroy the AudioSystem
-    ~AudioSystem();
+    virtual ~AudioSystem();
 
     // Updates the status of all the active sounds every frame
-    void Update(float deltaTime);
+    virtual void Update(float deltaTime);
     // Input for debugging purposes
     void ProcessInput(const Uint8* keyState);
 
@@ -86,43 +86,59 @@ public:
     // NOTE: The soundName is without the "Assets/Sounds/" part of the file
     //       For example, pass in "ChompLoop.wav" rather than
     //       "Assets/Sounds/ChompLoop.wav".
-    SoundHandle PlaySound(const std::string& soundName, bool looping = false, SoundCategory category = SoundCategory::SFX);
+    virtual SoundHandle PlaySound(const std::string& soundName, bool looping = false, SoundCategory category = SoundCategory::SFX);
+
+    // Streams a looping music track (Mix_Music) instead of decoding it into memory.
+    // The current track fades out over fadeSeconds and the new one fades in after it.
+    // The handle works with Stop/Pause/Resume/GetSoundState like any other sound.
+    virtual SoundHandle PlayMusic(const std::string& musicName, float fadeSeconds = 0.0f);
 
     // Stops the sound if it is currently playing
-    void StopSound(SoundHandle sound);
+    virtual void StopSound(SoundHandle sound);
 
     // Pauses the sound if it is currently playing
-    void PauseSound(SoundHandle sound);
+    virtual void PauseSound(SoundHandle sound);
 
     // Resumes the sound if it is currently paused
-    void ResumeSound(SoundHandle sound);
+    virtual void ResumeSound(SoundHandle sound);
 
     // Pauses all channels except the exception handle
-    void PauseAllSounds(SoundHandle exception = SoundHandle::Invalid);
+    virtual void PauseAllSounds(SoundHandle exception = SoundHandle::Invalid);
 
     // Resumes all channels except the exception handle 
-    void ResumeAllSounds(SoundHandle exception = SoundHandle::Invalid);
+    virtual void ResumeAllSounds(SoundHandle exception = SoundHandle::Invalid);
 
     // Sets the volume for a specific category (0-128)
-    void SetBusVolume(SoundCategory category, int volume);
+    virtual void SetBusVolume(SoundCategory category, int volume);
 
     // Gets the volume for a specific category
     int GetBusVolume(SoundCategory category) const;
 
     // Returns the current state of the sound
-    SoundState GetSoundState(SoundHandle sound);
+    virtual SoundState GetSoundState(SoundHandle sound);
+
+    // Channels currently playing a sound (music not included)
+    int GetActiveChannelCount() const;
 
     // Stops all sounds on all channels except the exception handle
-    void StopAllSounds(SoundHandle exception = SoundHandle::Invalid);
+    virtual void StopAllSounds(SoundHandle exception = SoundHandle::Invalid);
 
     // Cache all sounds under Assets/Sounds
-    void CacheAllSounds();
+    virtual void CacheAllSounds();
 
     // Used to preload the sound data of a sound
     // NOTE: The soundName is without the "Assets/Sounds/" part of the file
     //       For example, pass in "ChompLoop.wav" rather than
     //       "Assets/Sounds/ChompLoop.wav".
-    void CacheSound(const std::string& soundName);
+    virtual void CacheSound(const std::string& soundName);
+
+protected:
+    // For backends that never open the SDL_mixer device (see NullAudioSystem)
+    struct NoDevice {};
+    explicit AudioSystem(NoDevice);
+
+    int mSFXVolume = 128;
+    int mMusicVolume = 128;
 
 private:
     // If the sound is already loaded, returns Mix_Chunk from the map.
@@ -140,9 +156,18 @@ private:
         int mChannel = -1;
         bool mIsLooping = false;
         bool mIsPaused = false;
+        bool mIsMusic = false;
         SoundCategory mCategory = SoundCategory::SFX;
     };
 
+    // Channel operations that also understand the music stream
+    void PauseHandle(HandleInfo& info);
+    void ResumeHandle(HandleInfo& info);
+    void HaltHandle(SoundHandle handle, HandleInfo& info);
+
+    // Starts the queued track once the previous one finished fading out
+    void UpdateMusic();
+
     // Tracks the active SoundHandle for each channel
     // An Invalid SoundHandle means the channel is free, otherwise
     // it's an active handle.
@@ -154,6 +179,14 @@ private:
     // Map to store the Mix_Chunk data for all the files
     std::unordered_map<std::string, Mix_Chunk*> mSounds;
 
+    // Streamed music: the track playing (or fading out) and the one queued after it.
+    // Only these two are ever open, nothing is kept decoded.
+    struct _Mix_Music* mMusic = nullptr;
+    struct _Mix_Music* mPendingMusic = nullptr;
+    SoundHandle mMusicHandle;
+    SoundHandle mPendingMusicHandle;
+    int mMusicFadeMs = 0;
+
     // Used to track the last audio handle value used
     // Will increment prior to playing a new sound
     SoundHandle mLastHandle;
@@ -161,6 +194,5 @@ private:
     // Used for debug input in ProcessInput
     bool mLastDebugKey = false;
 
-    int mSFXVolume = 128;
-    int mMusicVolume = 128;
+    bool mHasDevice = true;
 };
@@ -8,11 +8,15 @@
 
 #include "Component.h"
 #include "../Actors/Actor.h"
+#include "../Memory/SceneArena.h"
+
+std::atomic<ComponentTypeId> Component::sNextTypeId{0};
 
 Component::Component(Actor* owner, int updateOrder)
           :mOwner(owner)
           ,mUpdateOrder(updateOrder)
           ,mIsEnabled(true)
+          ,mSystemIndex(-1)
 {
     // Add to actor's vector of components
     mOwner->AddComponent(this);
@@ -22,6 +26,16 @@ Component::~Component()
 {
 }
 
+void* Component::operator new(size_t size)
+{
+    return SceneArena::AllocateObject(size);
+}
+
+void Component::operator delete(void* p)
+{
+    SceneArena::FreeObject(p);
+}
+
 void Component::Update(float deltaTime)
 {
 }
@@ -34,6 +48,14 @@ void Component::DebugDraw(class Renderer* renderer)
 {
 }
 
+void Component::OnPoolRelease()
+{
+}
+
+void Component::OnPoolAcquire()
+{
+}
+
 class Game* Component::GetGame() const
 {
     return mOwner->GetGame();
@@ -7,16 +7,41 @@
 // ----------------------------------------------------------------
 
 #pragma once
+#include <atomic>
 #include <SDL_stdinc.h>
 
+using ComponentTypeId = unsigned int;
+
+// Put in the public section of every component class, so Actor::GetComponent
+// can find it by type without RTTI. Lookups match the exact class; a subclass
+// without its own COMPONENT_TYPE is found as its parent.
+#define COMPONENT_TYPE(Type) \
+    ComponentTypeId GetTypeId() const override { return Component::TypeIdOf<Type>(); }
+
 class Component
 {
 public:
+    // Small dense id per component class, fixed the first time it is asked
+    // for. Safe from any thread: two classes never get the same id
+    template <typename T>
+    static ComponentTypeId TypeIdOf()
+    {
+        static const ComponentTypeId id = sNextTypeId.fetch_add(1);
+        return id;
+    }
+
+    virtual ComponentTypeId GetTypeId() const { return TypeIdOf<Component>(); }
+
     // Constructor
     // (the lower the update order, the earlier the component updates)
     Component(class Actor* owner, int updateOrder = 100);
     // Destructor
     virtual ~Component();
+
+    // From the scene arena while a scene loads (see SceneArena); pooled
+    // component classes replace these with their own
+    static void* operator new(size_t size);
+    static void operator delete(void* p);
     // Update this component by delta time
     virtual void Update(float deltaTime);
     // Process input for this component (if needed)
@@ -24,6 +49,12 @@ public:
     // Debug draw for this component (if needed)
     virtual void DebugDraw(class Renderer* renderer);
 
+    // Object pools (see ActorPool): the owner goes back to its pool, or comes
+    // out of it. Overrides leave / rejoin the Game lists the constructor and
+    // destructor take care of, reset per-spawn state, and call the parent's
+    virtual void OnPoolRelease();
+    virtual void OnPoolAcquire();
+
     int GetUpdateOrder() const { return mUpdateOrder; }
     class Actor* GetOwner() const { return mOwner; }
     class Game* GetGame() const;
@@ -31,6 +62,9 @@ public:
     void SetEnabled(const bool enabled) { mIsEnabled = enabled; };
     bool IsEnabled() const { return mIsEnabled; };
 
+    // Swept by a ComponentSystem in system update mode instead of by its actor
+    bool IsUpdatedBySystem() const { return mSystemIndex >= 0; }
+
 protected:
     // Owning actor
     class Actor* mOwner;
@@ -38,4 +72,13 @@ protected:
     int mUpdateOrder;
     // Is component enabled
     bool mIsEnabled;
+
+private:
+    template <typename T>
+    friend class ComponentSystem;
+
+    // Slot in the ComponentSystem this component belongs to, if any
+    int mSystemIndex;
+
+    static std::atomic<ComponentTypeId> sNextTypeId;
 };
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// Memory for one component class: fixed-size slots carved out of large
+// chunks, so the components a system sweeps sit next to each other instead
+// of wherever the general heap put them. Freed slots are reused first.
+// Used through class-level operator new/delete.
+template <size_t SLOT_SIZE, size_t SLOTS_PER_CHUNK = 256>
+class ComponentPool
+{
+public:
+    ~ComponentPool()
+    {
+        for (char* chunk : mChunks)
+        {
+            ::operator delete(chunk);
+        }
+    }
+
+    void* Allocate(size_t size)
+    {
+        // A subclass that doesn't fit goes to the regular heap
+        if (size > SLOT_SIZE)
+        {
+            return ::operator new(size);
+        }
+
+        if (!mFree)
+        {
+            AddChunk();
+        }
+
+        FreeSlot* slot = mFree;
+        mFree = slot->next;
+        return slot;
+    }
+
+    void Free(void* p, size_t size)
+    {
+        if (!p)
+        {
+            return;
+        }
+
+        if (size > SLOT_SIZE)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        auto* slot = static_cast<FreeSlot*>(p);
+        slot->next = mFree;
+        mFree = slot;
+    }
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    static constexpr size_t ALIGN = alignof(std::max_align_t);
+    static constexpr size_t STRIDE = ((SLOT_SIZE < sizeof(FreeSlot) ? sizeof(FreeSlot) : SLOT_SIZE) + ALIGN - 1) / ALIGN * ALIGN;
+
+    void AddChunk()
+    {
+        char* chunk = static_cast<char*>(::operator new(STRIDE * SLOTS_PER_CHUNK));
+        mChunks.emplace_back(chunk);
+
+        // Threaded back to front so slots are handed out in address order
+        for (size_t i = SLOTS_PER_CHUNK; i-- > 0;)
+        {
+            auto* slot = reinterpret_cast<FreeSlot*>(chunk + i * STRIDE);
+            slot->next = mFree;
+            mFree = slot;
+        }
+    }
+
+    std::vector<char*> mChunks;
+    FreeSlot* mFree = nullptr;
+};
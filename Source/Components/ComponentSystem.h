@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Component.h"
+
+// Every component of one class, in creation order, for the system update
+// sweeps (see Game::UpdateActors). Removal only leaves a hole through the
+// index stored in the component; Compact closes them between sweeps.
+template <typename T>
+class ComponentSystem
+{
+public:
+    void Add(T* component)
+    {
+        component->mSystemIndex = static_cast<int>(mItems.size());
+        mItems.emplace_back(component);
+        mCount++;
+    }
+
+    void Remove(T* component)
+    {
+        int index = component->mSystemIndex;
+        if (index < 0 || index >= static_cast<int>(mItems.size()) || mItems[index] != component)
+        {
+            return;
+        }
+
+        mItems[index] = nullptr;
+        mHoles++;
+        mCount--;
+    }
+
+    // Forgets every component without touching them (they may already be dying)
+    void Clear()
+    {
+        mItems.clear();
+        mHoles = 0;
+        mCount = 0;
+    }
+
+    // Stable: survivors keep their relative order. Not during ForEach
+    void Compact()
+    {
+        if (mHoles == 0 || mTraversals > 0)
+        {
+            return;
+        }
+
+        size_t write = 0;
+        for (size_t read = 0; read < mItems.size(); read++)
+        {
+            if (T* component = mItems[read])
+            {
+                component->mSystemIndex = static_cast<int>(write);
+                mItems[write++] = component;
+            }
+        }
+
+        mItems.resize(write);
+        mHoles = 0;
+    }
+
+    size_t GetCount() const { return mCount; }
+    // Slots including holes; pass it to ForEach to leave out components added later
+    size_t GetSize() const { return mItems.size(); }
+    // Null for a hole. Read-only access, safe from job threads
+    T* GetAt(size_t index) const { return mItems[index]; }
+
+    // Calls func(component) for the first `limit` slots, by index: func may add
+    // components (visited only if within limit) or remove any of them
+    template <typename Func>
+    void ForEach(Func&& func, size_t limit = static_cast<size_t>(-1))
+    {
+        mTraversals++;
+        for (size_t i = 0; i < mItems.size() && i < limit; i++)
+        {
+            if (mItems[i])
+            {
+                func(mItems[i]);
+            }
+        }
+        mTraversals--;
+    }
+
+private:
+    std::vector<T*> mItems;
+    size_t mHoles = 0;
+    size_t mCount = 0;
+    int mTraversals = 0;
+};
@@ -5,10 +5,24 @@
 #include "AnimatorComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
-#include "../../Json.h"
 #include "../../Renderer/Texture.h"
+#include "../ComponentPool.h"
 #include <cmath>
-#include <fstream>
+
+namespace
+{
+    ComponentPool<sizeof(AnimatorComponent)> sPool;
+}
+
+void* AnimatorComponent::operator new(size_t size)
+{
+    return sPool.Allocate(size);
+}
+
+void AnimatorComponent::operator delete(void* p, size_t size)
+{
+    sPool.Free(p, size);
+}
 
 AnimatorComponent::AnimatorComponent(class Actor* owner, const std::string &texPath, const std::string &dataPath,
                                      int width, int height, int drawOrder)
@@ -32,12 +46,31 @@ AnimatorComponent::AnimatorComponent(class Actor* owner, const std::string &texP
     if (!dataPath.empty()) {
         LoadSpriteSheetData(texPath, dataPath);
     }
+
+    GetGame()->AddAnimator(this);
 }
 
 AnimatorComponent::~AnimatorComponent()
 {
+    GetGame()->RemoveAnimator(this);
     mAnimations.clear();
-    mSpriteFrames.clear();
+    ClearSpriteData();
+}
+
+void AnimatorComponent::OnPoolRelease()
+{
+    DrawComponent::OnPoolRelease();
+    GetGame()->RemoveAnimator(this);
+}
+
+void AnimatorComponent::OnPoolAcquire()
+{
+    DrawComponent::OnPoolAcquire();
+    GetGame()->AddAnimator(this);
+
+    mAnimTimer = 0.0f;
+    mIsFinished = false;
+    mIsTransitioning = false;
 }
 
 size_t AnimatorComponent::LoadSpriteSheetData(const std::string& texturePath, const std::string& dataPath)
@@ -46,62 +79,22 @@ size_t AnimatorComponent::LoadSpriteSheetData(const std::string& texturePath, co
         return mSpriteFrames.size();
     }
 
-    auto* texture = mOwner->GetGame()->GetRenderer()->GetTexture(texturePath);
-    if (!texture) {
-        SDL_Log("Failed to load sprite texture: %s", texturePath.c_str());
+    // Parsed once and shared: particles and drones spawn many animators on the same sheet
+    auto sheet = mOwner->GetGame()->GetRenderer()->GetSpriteSheet(texturePath, dataPath);
+    if (!sheet) {
         return mSpriteFrames.size();
     }
 
     if (!mDefaultTexture) {
-        mDefaultTexture = texture;
+        mDefaultTexture = sheet->texture;
     }
 
     size_t startIndex = mSpriteFrames.size();
 
-    if (dataPath.empty()) {
-        SpriteFrame frame;
-        frame.texture = texture;
-        frame.texRect = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
-        frame.pixelSize = Vector2(static_cast<float>(texture->GetWidth()), static_cast<float>(texture->GetHeight()));
-        mSpriteFrames.emplace_back(frame);
-        return startIndex;
-    }
-
-    std::ifstream spriteSheetFile(dataPath);
-
-    if (!spriteSheetFile.is_open()) {
-        SDL_Log("Failed to open sprite sheet data file: %s", dataPath.c_str());
-        return mSpriteFrames.size();
-    }
-
-    nlohmann::json spriteSheetData = nlohmann::json::parse(spriteSheetFile, nullptr, false);
-
-    if (spriteSheetData.is_discarded()) {
-        SDL_Log("Failed to parse sprite sheet data file: %s", dataPath.c_str());
-        return mSpriteFrames.size();
-    }
-
-    auto textureWidth = static_cast<float>(spriteSheetData["meta"]["size"]["w"].get<int>());
-    auto textureHeight = static_cast<float>(spriteSheetData["meta"]["size"]["h"].get<int>());
-
-    const auto& framesNode = spriteSheetData["frames"];
-
-    if (framesNode.is_array()) {
-        for (const auto& frame : framesNode) {
-            AppendFramesFromJson(frame, texture, textureWidth, textureHeight);
-        }
-    }
-    else if (framesNode.is_object()) {
-        std::vector<std::string> keys;
-        for (auto it = framesNode.begin(); it != framesNode.end(); ++it) {
-            keys.push_back(it.key());
-        }
-        std::sort(keys.begin(), keys.end());
-
-        for (const auto& key : keys) {
-            AppendFramesFromJson(framesNode[key], texture, textureWidth, textureHeight);
-        }
+    for (const auto& frame : sheet->frames) {
+        mSpriteFrames.emplace_back(&frame);
     }
+    mSpriteSheets.emplace_back(std::move(sheet));
 
     return startIndex;
 }
@@ -124,7 +117,7 @@ void AnimatorComponent::Draw(Renderer* renderer)
             if (!animFrames.empty()) {
                 int spriteIndex = animFrames[frameIndex % animFrames.size()];
                 if (spriteIndex >= 0 && spriteIndex < static_cast<int>(mSpriteFrames.size())) {
-                    activeFrame = &mSpriteFrames[spriteIndex];
+                    activeFrame = mSpriteFrames[spriteIndex];
                     texture = activeFrame->texture;
                     texRect = activeFrame->texRect;
                 }
@@ -132,7 +125,7 @@ void AnimatorComponent::Draw(Renderer* renderer)
         }
         else if (!mSpriteFrames.empty())
         {
-            activeFrame = &mSpriteFrames.front();
+            activeFrame = mSpriteFrames.front();
             texture = activeFrame->texture;
             texRect = activeFrame->texRect;
         }
@@ -201,6 +194,33 @@ void AnimatorComponent::Draw(Renderer* renderer)
     }
 }
 
+bool AnimatorComponent::GetWorldBounds(Vector2& outMin, Vector2& outMax) const
+{
+    float width = static_cast<float>(mWidth);
+    float height = static_cast<float>(mHeight);
+
+    // With frame aspect on, the width follows the frame: use the widest one
+    if (mUseFrameAspect)
+    {
+        float maxAspect = 1.0f;
+        for (const SpriteFrame* frame : mSpriteFrames)
+        {
+            if (frame->pixelSize.y > 0.0f)
+            {
+                maxAspect = Math::Max(maxAspect, frame->pixelSize.x / frame->pixelSize.y);
+            }
+        }
+        width = height * maxAspect;
+    }
+
+    float scaleX = fabsf(mOwner->GetScale().x);
+    float scaleY = fabsf(mOwner->GetScale().y);
+    Vector2 size(width * (scaleX <= 0.0f ? 1.0f : scaleX), height * (scaleY <= 0.0f ? 1.0f : scaleY));
+
+    ComputeQuadBounds(mOwner->GetPosition() + mDrawOffset, size, mOwner->GetRotation(), outMin, outMax);
+    return true;
+}
+
 void AnimatorComponent::Update(float deltaTime)
 {
     if (mIsPaused || mAnimations.empty() || mAnimName.empty()) {
@@ -316,33 +336,5 @@ void AnimatorComponent::SetSpriteSheet(const std::string& texturePath, const std
 void AnimatorComponent::ClearSpriteData()
 {
     mSpriteFrames.clear();
-}
-
-void AnimatorComponent::AppendFramesFromJson(const nlohmann::json& frameNode, Texture* texture,
-                                            float textureWidth, float textureHeight)
-{
-    if (!frameNode.contains("frame")) {
-        return;
-    }
-
-    const auto& frame = frameNode["frame"];
-    int x = frame["x"].get<int>();
-    int y = frame["y"].get<int>();
-    int w = frame["w"].get<int>();
-    int h = frame["h"].get<int>();
-
-    if (w <= 0 || h <= 0) {
-        return;
-    }
-
-    SpriteFrame spriteFrame{};
-    spriteFrame.texture = texture;
-    spriteFrame.texRect = Vector4(
-            static_cast<float>(x) / textureWidth,
-            static_cast<float>(y) / textureHeight,
-            static_cast<float>(w) / textureWidth,
-            static_cast<float>(h) / textureHeight);
-    spriteFrame.pixelSize = Vector2(static_cast<float>(w), static_cast<float>(h));
-
-    mSpriteFrames.emplace_back(spriteFrame);
+    mSpriteSheets.clear();
 }
\ No newline at end of file
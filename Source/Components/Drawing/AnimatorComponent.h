@@ -4,20 +4,32 @@
 
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include "DrawComponent.h"
 #include "../../Json.h"
+#include "../../Renderer/SpriteSheetCache.h"
 
 class AnimatorComponent : public DrawComponent {
 public:
+    COMPONENT_TYPE(AnimatorComponent)
+
     // (Lower draw order corresponds with further back)
     AnimatorComponent(class Actor* owner, const std::string &texturePath, const std::string &dataPath,
             int width, int height, int drawOrder = 100);
     ~AnimatorComponent() override;
 
+    // Pooled, so the animation sweep walks contiguous memory
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
     void Draw(Renderer* renderer) override;
     void Update(float deltaTime) override;
+    void OnPoolRelease() override;
+    // Also restarts the current animation
+    void OnPoolAcquire() override;
+    bool GetWorldBounds(Vector2& outMin, Vector2& outMax) const override;
 
     // Use to change the FPS of the animation
     void SetAnimFPS(float fps) { mAnimFPS = fps; }
@@ -61,22 +73,17 @@ public:
     void SetSpriteSheet(const std::string& texturePath, const std::string& dataPath);
 
 private:
-    struct SpriteFrame {
-        class Texture* texture;
-        Vector4 texRect;
-        Vector2 pixelSize;
-    };
-
     size_t LoadSpriteSheetData(const std::string& texturePath, const std::string& dataPath);
     void ClearSpriteData();
-    void AppendFramesFromJson(const nlohmann::json& frameNode, class Texture* texture,
-                              float textureWidth, float textureHeight);
 
     // Sprite sheet texture
     class Texture* mDefaultTexture;
 
+    // Sheets from the renderer cache; they own the frames below
+    std::vector<std::shared_ptr<const SpriteSheet>> mSpriteSheets;
+
     // Vector of frames (each knows which texture it references)
-    std::vector<SpriteFrame> mSpriteFrames;
+    std::vector<const SpriteFrame*> mSpriteFrames;
 
     // Map of animation name to vector of textures corresponding to the animation
     std::unordered_map<std::string, std::vector<int>> mAnimations;
@@ -13,6 +13,8 @@ DrawComponent::DrawComponent(class Actor *owner, int drawOrder)
         , mIsVegetation(false)
         , mColor(Vector3::One)
         , mAlpha(1.0f)
+        , mRegistryIndex(-1)
+        , mRegistryGeneration(0)
 {
     mOwner->GetGame()->AddDrawable(this);
 }
@@ -22,7 +24,32 @@ DrawComponent::~DrawComponent()
     mOwner->GetGame()->RemoveDrawable(this);
 }
 
+void DrawComponent::OnPoolRelease()
+{
+    mOwner->GetGame()->RemoveDrawable(this);
+}
+
+void DrawComponent::OnPoolAcquire()
+{
+    mOwner->GetGame()->AddDrawable(this);
+}
+
 void DrawComponent::Draw(Renderer *renderer)
 {
 
 }
+
+void DrawComponent::ComputeQuadBounds(const Vector2& center, const Vector2& size, float rotation,
+                                      Vector2& outMin, Vector2& outMax)
+{
+    Vector2 half(Math::Abs(size.x) * 0.5f, Math::Abs(size.y) * 0.5f);
+
+    if (rotation != 0.0f)
+    {
+        float radius = half.Length();
+        half = Vector2(radius, radius);
+    }
+
+    outMin = center - half;
+    outMax = center + half;
+}
@@ -13,6 +13,8 @@
 class DrawComponent : public Component
 {
 public:
+    COMPONENT_TYPE(DrawComponent)
+
     // (Lower draw order corresponds with further back)
     DrawComponent(class Actor* owner, int drawOrder = 100);
     ~DrawComponent();
@@ -20,6 +22,13 @@ public:
     virtual void Draw(Renderer* renderer);
     int GetDrawOrder() const { return mDrawOrder; }
 
+    void OnPoolRelease() override;
+    void OnPoolAcquire() override;
+
+    // World-space box covered by this drawable, used to cull it against the camera.
+    // Returns false when unknown or screen-anchored, so it's always drawn.
+    virtual bool GetWorldBounds(Vector2& /*outMin*/, Vector2& /*outMax*/) const { return false; }
+
     bool IsVisible() const { return mIsVisible; }
     void SetVisible(bool visible) { mIsVisible = visible; }
     void SetColor(const Vector3& color) { mColor = color; }
@@ -31,9 +40,20 @@ public:
     float GetAlpha() const { return mAlpha; }
 
 protected:
+    // Box of a quad centered at center, grown to fit any rotation
+    static void ComputeQuadBounds(const Vector2& center, const Vector2& size, float rotation,
+                                  Vector2& outMin, Vector2& outMax);
+
     int mDrawOrder;
     bool mIsVisible;
     bool mIsVegetation;
     Vector3 mColor;
     float mAlpha;
+
+private:
+    friend class DrawableRegistry;
+
+    // Slot in the registry bucket for mDrawOrder (-1 when not registered)
+    int mRegistryIndex;
+    unsigned int mRegistryGeneration;
 };
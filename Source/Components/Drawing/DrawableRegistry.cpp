@@ -0,0 +1,79 @@
+#include "DrawableRegistry.h"
+#include "DrawComponent.h"
+
+DrawableRegistry::DrawableRegistry()
+    : mCount(0)
+    , mGeneration(1)
+{
+}
+
+void DrawableRegistry::Add(DrawComponent* drawable)
+{
+    Bucket& bucket = mBuckets[drawable->GetDrawOrder()];
+
+    drawable->mRegistryIndex = static_cast<int>(bucket.items.size());
+    drawable->mRegistryGeneration = mGeneration;
+    bucket.items.emplace_back(drawable);
+    mCount++;
+}
+
+void DrawableRegistry::Remove(DrawComponent* drawable)
+{
+    if (drawable->mRegistryGeneration != mGeneration || drawable->mRegistryIndex < 0)
+    {
+        return;
+    }
+
+    auto iter = mBuckets.find(drawable->GetDrawOrder());
+    if (iter == mBuckets.end())
+    {
+        return;
+    }
+
+    Bucket& bucket = iter->second;
+    int index = drawable->mRegistryIndex;
+    if (index >= static_cast<int>(bucket.items.size()) || bucket.items[index] != drawable)
+    {
+        return;
+    }
+
+    bucket.items[index] = nullptr;
+    bucket.holes++;
+    mCount--;
+
+    drawable->mRegistryIndex = -1;
+}
+
+void DrawableRegistry::Clear()
+{
+    mBuckets.clear();
+    mCount = 0;
+    mGeneration++;
+}
+
+void DrawableRegistry::Compact()
+{
+    for (auto& entry : mBuckets)
+    {
+        Bucket& bucket = entry.second;
+        if (bucket.holes == 0)
+        {
+            continue;
+        }
+
+        // Stable: survivors keep their relative order
+        size_t write = 0;
+        for (size_t read = 0; read < bucket.items.size(); read++)
+        {
+            DrawComponent* drawable = bucket.items[read];
+            if (drawable)
+            {
+                drawable->mRegistryIndex = static_cast<int>(write);
+                bucket.items[write++] = drawable;
+            }
+        }
+
+        bucket.items.resize(write);
+        bucket.holes = 0;
+    }
+}
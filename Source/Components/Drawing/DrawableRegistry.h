@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <map>
+#include <vector>
+
+// Draw components bucketed by draw order. Buckets keep insertion order, and
+// removal only leaves a hole through the index stored in the component; the
+// holes are compacted on the next traversal.
+class DrawableRegistry
+{
+public:
+    DrawableRegistry();
+
+    void Add(class DrawComponent* drawable);
+    void Remove(class DrawComponent* drawable);
+
+    // Forgets every drawable without touching them (they may already be dying)
+    void Clear();
+
+    size_t GetCount() const { return mCount; }
+
+    // Calls func(drawable) back to front, in insertion order within a draw order
+    template <typename Func>
+    void ForEach(Func&& func)
+    {
+        Compact();
+
+        for (auto& entry : mBuckets)
+        {
+            // By index: func may add drawables to this bucket
+            std::vector<class DrawComponent*>& items = entry.second.items;
+            for (size_t i = 0; i < items.size(); i++)
+            {
+                if (items[i])
+                {
+                    func(items[i]);
+                }
+            }
+        }
+    }
+
+private:
+    struct Bucket
+    {
+        std::vector<class DrawComponent*> items;
+        int holes = 0;
+    };
+
+    void Compact();
+
+    std::map<int, Bucket> mBuckets;
+    size_t mCount;
+
+    // Bumped by Clear so stale indices left in components are ignored
+    unsigned int mGeneration;
+};
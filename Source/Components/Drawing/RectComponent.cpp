@@ -21,6 +21,13 @@ RectComponent::~RectComponent()
 
 }
 
+bool RectComponent::GetWorldBounds(Vector2& outMin, Vector2& outMax) const
+{
+    ComputeQuadBounds(mOwner->GetPosition(), Vector2(static_cast<float>(mWidth), static_cast<float>(mHeight)),
+                      mOwner->GetRotation(), outMin, outMax);
+    return true;
+}
+
 void RectComponent::Draw(class Renderer *renderer)
 {
     if(mIsVisible)
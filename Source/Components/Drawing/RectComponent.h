@@ -10,6 +10,8 @@
 class RectComponent : public DrawComponent
 {
 public:
+    COMPONENT_TYPE(RectComponent)
+
     RectComponent(class Actor* owner, int width, int height, RendererMode mode, int drawOrder = 100);
     ~RectComponent();
 
@@ -17,6 +19,7 @@ public:
     void SetHeight(int height) { mHeight = height; }
 
     void Draw(class Renderer* renderer) override;
+    bool GetWorldBounds(Vector2& outMin, Vector2& outMax) const override;
 
 private:
     int mWidth;
@@ -66,6 +66,17 @@ void SpriteComponent::Draw(Renderer* renderer)
     }
 }
 
+bool SpriteComponent::GetWorldBounds(Vector2& outMin, Vector2& outMax) const
+{
+    Vector2 scale = mOwner->GetScale();
+    int width = mUseSrcRect ? mSrcRect.w : mTexWidth;
+    int height = mUseSrcRect ? mSrcRect.h : mTexHeight;
+
+    Vector2 size(width * scale.x * mFlipScale.x, height * scale.y * mFlipScale.y);
+    ComputeQuadBounds(mOwner->GetPosition() + mDrawOffset, size, mOwner->GetRotation(), outMin, outMax);
+    return true;
+}
+
 void SpriteComponent::SetTexture(Texture* texture)
 {
     mTexture = texture;
@@ -6,11 +6,14 @@
 class SpriteComponent : public DrawComponent
 {
 public:
+    COMPONENT_TYPE(SpriteComponent)
+
     // O drawOrder define quem é desenhado na frente (número maior = mais na frente)
     SpriteComponent(class Actor* owner, int drawOrder = 100);
     ~SpriteComponent();
 
     void Draw(class Renderer* renderer) override;
+    bool GetWorldBounds(Vector2& outMin, Vector2& outMax) const override;
     virtual void SetTexture(class Texture* texture);
     class Texture* GetTexture() const { return mTexture; }
 
@@ -0,0 +1,186 @@
+#include "TileLayerRenderer.h"
+#include "../../Actors/Actor.h"
+#include "../../Game.h"
+#include "../../Renderer/Texture.h"
+#include <cmath>
+#include <map>
+#include <tuple>
+
+TileLayerRenderer::TileLayerRenderer(Actor* owner, int drawOrder)
+    : DrawComponent(owner, drawOrder)
+{
+}
+
+TileLayerRenderer::~TileLayerRenderer()
+{
+    ClearChunks();
+}
+
+void TileLayerRenderer::AddTile(int layer, Texture* texture, int srcX, int srcY, int size,
+                                const Vector2& position, float rotation, const Vector2& flipScale)
+{
+    PendingTile tile;
+    tile.info.texture = texture;
+    tile.info.layer = layer;
+    tile.info.srcX = srcX;
+    tile.info.srcY = srcY;
+    tile.info.size = size;
+    tile.info.position = position;
+    tile.rotation = rotation;
+    tile.flipScale = flipScale;
+
+    mTiles.emplace_back(tile);
+}
+
+void TileLayerRenderer::Build()
+{
+    ClearChunks();
+
+    // Agrupa os tiles por (camada, chunk); o std::map já deixa tudo na ordem de desenho
+    std::map<std::tuple<int, int, int>, std::vector<int>> chunkTiles;
+    for (int i = 0; i < static_cast<int>(mTiles.size()); i++)
+    {
+        const TileInfo& info = mTiles[i].info;
+        float chunkSize = static_cast<float>(CHUNK_TILES * info.size);
+        int chunkX = static_cast<int>(std::floor(info.position.x / chunkSize));
+        int chunkY = static_cast<int>(std::floor(info.position.y / chunkSize));
+        chunkTiles[std::make_tuple(info.layer, chunkY, chunkX)].emplace_back(i);
+    }
+
+    // Same quad as Renderer::CreateSpriteVerts
+    const Vector2 corners[4] = {
+        Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(0.5f, 0.5f), Vector2(-0.5f, 0.5f)
+    };
+    const Vector2 uvs[4] = {
+        Vector2(0.0f, 0.0f), Vector2(1.0f, 0.0f), Vector2(1.0f, 1.0f), Vector2(0.0f, 1.0f)
+    };
+
+    for (const auto& entry : chunkTiles)
+    {
+        TileChunk chunk;
+        chunk.layer = std::get<0>(entry.first);
+        chunk.min = Vector2(Math::Infinity, Math::Infinity);
+        chunk.max = Vector2(Math::NegInfinity, Math::NegInfinity);
+
+        // Um buffer por textura, na ordem em que as texturas aparecem no chunk
+        std::vector<Texture*> textures;
+        std::vector<std::vector<float>> vertices;
+        std::vector<std::vector<unsigned int>> indices;
+
+        for (int tileIndex : entry.second)
+        {
+            const PendingTile& tile = mTiles[tileIndex];
+            Texture* texture = tile.info.texture;
+
+            size_t batch = 0;
+            while (batch < textures.size() && textures[batch] != texture)
+            {
+                batch++;
+            }
+            if (batch == textures.size())
+            {
+                textures.emplace_back(texture);
+                vertices.emplace_back();
+                indices.emplace_back();
+            }
+
+            // Bake Scale(size * flip) * RotationZ * Translation into world-space corners
+            float size = static_cast<float>(tile.info.size);
+            float cosR = Math::Cos(tile.rotation);
+            float sinR = Math::Sin(tile.rotation);
+
+            float invW = 1.0f / texture->GetWidth();
+            float invH = 1.0f / texture->GetHeight();
+            Vector4 texRect(tile.info.srcX * invW, tile.info.srcY * invH, size * invW, size * invH);
+
+            unsigned int base = static_cast<unsigned int>(vertices[batch].size() / 4);
+            for (int c = 0; c < 4; c++)
+            {
+                float x = corners[c].x * size * tile.flipScale.x;
+                float y = corners[c].y * size * tile.flipScale.y;
+                Vector2 world(x * cosR - y * sinR + tile.info.position.x,
+                              x * sinR + y * cosR + tile.info.position.y);
+
+                vertices[batch].push_back(world.x);
+                vertices[batch].push_back(world.y);
+                vertices[batch].push_back(texRect.x + uvs[c].x * texRect.z);
+                vertices[batch].push_back(texRect.y + uvs[c].y * texRect.w);
+
+                chunk.min.x = Math::Min(chunk.min.x, world.x);
+                chunk.min.y = Math::Min(chunk.min.y, world.y);
+                chunk.max.x = Math::Max(chunk.max.x, world.x);
+                chunk.max.y = Math::Max(chunk.max.y, world.y);
+            }
+
+            const unsigned int quadIndices[6] = { 0, 1, 2, 2, 3, 0 };
+            for (unsigned int index : quadIndices)
+            {
+                indices[batch].push_back(base + index);
+            }
+        }
+
+        for (size_t batch = 0; batch < textures.size(); batch++)
+        {
+            TileBatch tileBatch;
+            tileBatch.texture = textures[batch];
+            tileBatch.vertices = new VertexArray(vertices[batch].data(), static_cast<unsigned int>(vertices[batch].size() / 4),
+                                                 indices[batch].data(), static_cast<unsigned int>(indices[batch].size()));
+            chunk.batches.emplace_back(tileBatch);
+        }
+
+        mChunks.emplace_back(chunk);
+    }
+}
+
+void TileLayerRenderer::Draw(Renderer* renderer)
+{
+    Game* game = mOwner->GetGame();
+    Vector2 cameraPos = game->GetCameraPos();
+
+    // Menus draw at zoom 1, so never assume a smaller view than that
+    float zoom = Math::Min(game->GetZoomScale(), 1.0f);
+    Vector2 viewMin = cameraPos;
+    Vector2 viewMax = cameraPos + Vector2(Game::WINDOW_WIDTH / zoom, Game::WINDOW_HEIGHT / zoom);
+
+    for (const auto& chunk : mChunks)
+    {
+        if (chunk.max.x < viewMin.x || chunk.min.x > viewMax.x ||
+            chunk.max.y < viewMin.y || chunk.min.y > viewMax.y)
+        {
+            continue;
+        }
+
+        for (const auto& batch : chunk.batches)
+        {
+            renderer->DrawWorldGeometry(batch.vertices, batch.texture, cameraPos, mColor, mAlpha);
+        }
+    }
+}
+
+const TileLayerRenderer::TileInfo* TileLayerRenderer::FindTileNear(const Vector2& position, float radius) const
+{
+    float radiusSq = radius * radius;
+
+    // Tiles are queued layer by layer, so the first match is the backmost one
+    for (const auto& tile : mTiles)
+    {
+        if ((tile.info.position - position).LengthSq() < radiusSq)
+        {
+            return &tile.info;
+        }
+    }
+
+    return nullptr;
+}
+
+void TileLayerRenderer::ClearChunks()
+{
+    for (auto& chunk : mChunks)
+    {
+        for (auto& batch : chunk.batches)
+        {
+            delete batch.vertices;
+        }
+    }
+    mChunks.clear();
+}
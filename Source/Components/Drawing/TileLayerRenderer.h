@@ -0,0 +1,69 @@
+#pragma once
+#include "DrawComponent.h"
+#include <vector>
+
+// Draws the Tiled tile layers of a level. Tiles are baked at load into
+// fixed-size chunks, each holding one static vertex buffer per texture,
+// and only the chunks overlapping the camera are drawn.
+class TileLayerRenderer : public DrawComponent
+{
+public:
+    COMPONENT_TYPE(TileLayerRenderer)
+
+    struct TileInfo
+    {
+        class Texture* texture;
+        int layer;
+        int srcX;
+        int srcY;
+        int size;
+        Vector2 position;
+    };
+
+    TileLayerRenderer(class Actor* owner, int drawOrder = 100);
+    ~TileLayerRenderer();
+
+    // Queues a tile. Rotation and flip scale follow the Tiled flags, like Block::SetFlipData
+    void AddTile(int layer, class Texture* texture, int srcX, int srcY, int size,
+                 const Vector2& position, float rotation, const Vector2& flipScale);
+
+    // Bakes every queued tile into the chunk vertex buffers
+    void Build();
+
+    void Draw(class Renderer* renderer) override;
+
+    // First queued tile whose center is within radius of position
+    const TileInfo* FindTileNear(const Vector2& position, float radius) const;
+
+    int GetNumChunks() const { return static_cast<int>(mChunks.size()); }
+
+private:
+    // Chunk side, in tiles
+    static const int CHUNK_TILES = 32;
+
+    struct PendingTile
+    {
+        TileInfo info;
+        float rotation;
+        Vector2 flipScale;
+    };
+
+    struct TileBatch
+    {
+        class Texture* texture;
+        class VertexArray* vertices;
+    };
+
+    struct TileChunk
+    {
+        int layer;
+        Vector2 min;
+        Vector2 max;
+        std::vector<TileBatch> batches;
+    };
+
+    void ClearChunks();
+
+    std::vector<PendingTile> mTiles;
+    std::vector<TileChunk> mChunks;
+};
@@ -129,7 +129,7 @@ void TutorialDrawComponent::ProcessInput(const uint8_t* keyState)
     }
 
     int x, y;
-    Uint32 buttons = SDL_GetMouseState(&x, &y);
+    Uint32 buttons = mOwner->GetGame()->GetMouseState(&x, &y);
     if (buttons & SDL_BUTTON(SDL_BUTTON_LEFT))
     {
         if (spaceman)
@@ -6,6 +6,8 @@
 class TutorialDrawComponent : public DrawComponent
 {
 public:
+    COMPONENT_TYPE(TutorialDrawComponent)
+
     TutorialDrawComponent(class Actor* owner);
     ~TutorialDrawComponent();
 
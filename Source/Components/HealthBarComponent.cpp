@@ -10,6 +10,15 @@ HealthBarComponent::HealthBarComponent(Actor* owner, int maxHP, int* currentHP)
 {
 }
 
+bool HealthBarComponent::GetWorldBounds(Vector2& outMin, Vector2& outMax) const
+{
+    // Same placement as Draw: 100x10 bar above the head
+    Vector2 pos = mOwner->GetPosition();
+    pos.y -= 100.0f;
+    ComputeQuadBounds(pos, Vector2(100.0f, 10.0f), 0.0f, outMin, outMax);
+    return true;
+}
+
 void HealthBarComponent::Draw(Renderer* renderer)
 {
     if (!mCurrentHP) return;
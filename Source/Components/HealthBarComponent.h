@@ -5,8 +5,11 @@
 class HealthBarComponent : public DrawComponent
 {
 public:
+    COMPONENT_TYPE(HealthBarComponent)
+
     HealthBarComponent(class Actor* owner, int maxHP, int* currentHP);
     void Draw(class Renderer* renderer) override;
+    bool GetWorldBounds(Vector2& outMin, Vector2& outMax) const override;
 
 private:
     int mMaxHP;
@@ -6,6 +6,30 @@
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
 #include "RigidBodyComponent.h"
+#include "../../Physics/SpatialHashGrid.h"
+#include "../../Physics/TileMapCollider.h"
+#include "../../Profiler.h"
+#include "../ComponentPool.h"
+
+namespace
+{
+    ComponentPool<sizeof(AABBColliderComponent)> sPool;
+
+    bool IsSame(const Vector2& a, const Vector2& b)
+    {
+        return a.x == b.x && a.y == b.y;
+    }
+}
+
+void* AABBColliderComponent::operator new(size_t size)
+{
+    return sPool.Allocate(size);
+}
+
+void AABBColliderComponent::operator delete(void* p, size_t size)
+{
+    sPool.Free(p, size);
+}
 
 AABBColliderComponent::AABBColliderComponent(class Actor* owner, int dx, int dy, int w, int h,
         ColliderLayer layer, bool isTrigger, bool isStatic, int updateOrder)
@@ -25,28 +49,62 @@ AABBColliderComponent::~AABBColliderComponent()
     GetGame()->RemoveCollider(this);
 }
 
+void AABBColliderComponent::OnPoolRelease()
+{
+    GetGame()->RemoveCollider(this);
+}
+
+void AABBColliderComponent::OnPoolAcquire()
+{
+    // Bucketed lazily, once the new owner is positioned
+    GetGame()->AddCollider(this);
+}
+
 Vector2 AABBColliderComponent::GetMin() const
 {
-    Vector2 center = mOwner->GetPosition() + mOffset;
+    return GetMinAt(mOwner->GetPosition());
+}
+
+Vector2 AABBColliderComponent::GetMax() const
+{
+    return GetMaxAt(mOwner->GetPosition());
+}
+
+Vector2 AABBColliderComponent::GetMinAt(const Vector2& position) const
+{
+    Vector2 center = position + mOffset;
     float halfWidth = mWidth / 2.0f;
     float halfHeight = mHeight / 2.0f;
     return Vector2(center.x - halfWidth, center.y - halfHeight);
 }
 
-Vector2 AABBColliderComponent::GetMax() const
+Vector2 AABBColliderComponent::GetMaxAt(const Vector2& position) const
 {
-    Vector2 center = mOwner->GetPosition() + mOffset;
+    Vector2 center = position + mOffset;
     float halfWidth = mWidth / 2.0f;
     float halfHeight = mHeight / 2.0f;
     return Vector2(center.x + halfWidth, center.y + halfHeight);
 }
 
+int AABBColliderComponent::sPairTests = 0;
+
 bool AABBColliderComponent::Intersect(const AABBColliderComponent& b) const
+{
+    sPairTests++;
+    return Intersect(b.GetMin(), b.GetMax());
+}
+
+int AABBColliderComponent::TakePairTestCount()
+{
+    int count = sPairTests;
+    sPairTests = 0;
+    return count;
+}
+
+bool AABBColliderComponent::Intersect(const Vector2& bMin, const Vector2& bMax) const
 {
     Vector2 aMin = this->GetMin();
     Vector2 aMax = this->GetMax();
-    Vector2 bMin = b.GetMin();
-    Vector2 bMax = b.GetMax();
 
     bool overlapX = (aMax.x >= bMin.x) && (aMin.x <= bMax.x);
     bool overlapY = (aMax.y >= bMin.y) && (aMin.y <= bMax.y);
@@ -54,159 +112,260 @@ bool AABBColliderComponent::Intersect(const AABBColliderComponent& b) const
     return overlapX && overlapY;
 }
 
-float AABBColliderComponent::GetMinVerticalOverlap(AABBColliderComponent* b) const
+bool AABBColliderComponent::GetAxisOverlap(bool vertical, const Vector2& aMin, const Vector2& aMax,
+                                           const Vector2& bMin, const Vector2& bMax, float velocityY, float& overlap)
 {
-    Vector2 aMin = this->GetMin();
-    Vector2 aMax = this->GetMax();
-    Vector2 bMin = b->GetMin();
-    Vector2 bMax = b->GetMax();
+    bool overlapX = (aMax.x >= bMin.x) && (aMin.x <= bMax.x);
+    bool overlapY = (aMax.y >= bMin.y) && (aMin.y <= bMax.y);
+    if (!overlapX || !overlapY) {
+        return false;
+    }
+
+    float dx1 = bMax.x - aMin.x;
+    float dx2 = aMax.x - bMin.x;
+    float minXOverlap = dx1 < dx2 ? -dx1 : dx2;
 
     float dy1 = bMax.y - aMin.y;
     float dy2 = aMax.y - bMin.y;
+    float minYOverlap = dy1 < dy2 ? -dy1 : dy2;
 
-    if (dy1 < dy2) {
-        return -dy1;
+    // Fix for "seam" issue: If falling and hitting floor, prefer vertical resolution
+    float yBias = 1.0f;
+    if (velocityY > 0.0f && minYOverlap > 0.0f) {
+        yBias = 0.01f; // Strong bias to treat Y overlap as small
     }
-    else {
-        return dy2;
+
+    if (vertical) {
+        overlap = minYOverlap;
+        return fabs(minYOverlap) * yBias <= fabs(minXOverlap);
     }
+    overlap = minXOverlap;
+    return fabs(minXOverlap) < fabs(minYOverlap) * yBias;
 }
 
-float AABBColliderComponent::GetMinHorizontalOverlap(AABBColliderComponent* b) const
+bool AABBColliderComponent::ResolveOverlap(bool vertical, float overlap, Vector2& position, Vector2& velocity)
 {
-    Vector2 aMin = this->GetMin();
-    Vector2 aMax = this->GetMax();
-    Vector2 bMin = b->GetMin();
-    Vector2 bMax = b->GetMax();
+    // Clamp overlap to avoid teleportation
+    float maxOverlap = static_cast<float>(Game::TILE_SIZE);
+    float push = Math::Clamp<float>(overlap, -maxOverlap, maxOverlap);
 
-    float dx1 = bMax.x - aMin.x;
-    float dx2 = aMax.x - bMin.x;
-    
-    if (dx1 < dx2) {
-        return -dx1;
+    if (vertical) {
+        position.y -= push;
+        velocity.y = 0.0f;
+        return overlap > 0.0f;
     }
-    else {
-        return dx2;
+
+    position.x -= push;
+    velocity.x = 0.0f;
+    return false;
+}
+
+void AABBColliderComponent::ApplyResolution(bool vertical, RigidBodyComponent* rigidBody, float overlap)
+{
+    Vector2 position = mOwner->GetPosition();
+    Vector2 velocity = rigidBody->GetVelocity();
+    bool grounded = ResolveOverlap(vertical, overlap, position, velocity);
+
+    mOwner->SetPosition(position);
+    rigidBody->SetVelocity(velocity);
+    if (grounded) {
+        mOwner->SetOnGround();
     }
 }
 
-float AABBColliderComponent::DetectHorizontalCollision(RigidBodyComponent *rigidBody)
+float AABBColliderComponent::DetectHorizontalCollision(RigidBodyComponent *rigidBody, const TilePassPrediction* tiles)
+{
+    PROFILE_SCOPE("AABBColliderComponent::DetectHorizontalCollision");
+
+    DetectCollision(false, rigidBody, tiles);
+    return 0.0f;
+}
+
+float AABBColliderComponent::DetectVertialCollision(RigidBodyComponent *rigidBody, const TilePassPrediction* tiles)
 {
-    if (mIsStatic || !IsEnabled()) return 0.0f;
+    PROFILE_SCOPE("AABBColliderComponent::DetectVertialCollision");
 
-    auto colliders = GetGame()->GetColliders();
+    DetectCollision(true, rigidBody, tiles);
+    return 0.0f;
+}
+
+void AABBColliderComponent::DetectCollision(bool vertical, RigidBodyComponent* rigidBody, const TilePassPrediction* tiles)
+{
+    if (mIsStatic || !IsEnabled()) return;
+
+    // Terreno primeiro, direto do grid do mapa (antes eram os primeiros colliders registrados)
+    if (tiles) {
+        ReplayTiles(vertical, rigidBody, *tiles);
+    }
+    else {
+        Vector2 pad(static_cast<float>(Game::TILE_SIZE), static_cast<float>(Game::TILE_SIZE));
+        SweepTiles(vertical, rigidBody, GetMin() - pad, GetMax() + pad, 0);
+    }
+
+    auto colliders = GetGame()->GetFrameArena()->MakeVector<AABBColliderComponent*>();
+    QueryNearbyColliders(colliders, static_cast<float>(Game::TILE_SIZE));
 
     for (auto collider : colliders) {
         if (collider == this || !collider->IsEnabled()) {
             continue;
         }
 
-        if (this->Intersect(*collider)) {
-            float minXOverlap = GetMinHorizontalOverlap(collider);
-            float minYOverlap = GetMinVerticalOverlap(collider);
-
-            // Fix for "seam" issue: If falling and hitting floor, prefer vertical resolution
-            float yBias = 1.0f;
-            if (rigidBody->GetVelocity().y > 0.0f && minYOverlap > 0.0f) {
-                yBias = 0.01f; // Strong bias to treat Y overlap as small
+        float overlap;
+        if (this->Intersect(*collider) &&
+            GetAxisOverlap(vertical, GetMin(), GetMax(), collider->GetMin(), collider->GetMax(),
+                           rigidBody->GetVelocity().y, overlap)) {
+            if (!collider->IsTrigger()) {
+                ApplyResolution(vertical, rigidBody, overlap);
             }
 
-            if (fabs(minXOverlap) < fabs(minYOverlap) * yBias) {
-                if (!collider->IsTrigger()) {
-                    ResolveHorizontalCollisions(rigidBody, minXOverlap);
-                }
-                mOwner->OnHorizontalCollision(minXOverlap, collider);
+            if (vertical) {
+                mOwner->OnVerticalCollision(overlap, collider);
+            }
+            else {
+                mOwner->OnHorizontalCollision(overlap, collider);
             }
         }
     }
-
-    return 0.0f;
 }
 
-float AABBColliderComponent::DetectVertialCollision(RigidBodyComponent *rigidBody)
+void AABBColliderComponent::PredictTilePass(bool vertical, Vector2& position, Vector2& velocity, TilePassPrediction& out)
 {
-    if (mIsStatic || !IsEnabled()) return 0.0f;
+    out.startPosition = position;
+    out.startVelocity = velocity;
+    out.offset = mOffset;
+    out.width = mWidth;
+    out.height = mHeight;
+    out.contacts.clear();
+
+    Vector2 pad(static_cast<float>(Game::TILE_SIZE), static_cast<float>(Game::TILE_SIZE));
+    out.queryMin = GetMinAt(position) - pad;
+    out.queryMax = GetMaxAt(position) + pad;
+
+    // The map is only read here; the proxy and the callbacks wait for the replay
+    TileMapCollider* tileMap = GetGame()->GetTileMap();
+    if (!tileMap) {
+        return;
+    }
 
-    auto colliders = GetGame()->GetColliders();
+    int cellIndex = 0;
+    tileMap->ForEachSolidCell(out.queryMin, out.queryMax, [&](const Vector2& cellMin, const Vector2& cellMax) {
+        int index = cellIndex++;
 
-    for (auto collider : colliders) {
-        if (collider == this || !collider->IsEnabled()) {
-            continue;
+        float overlap;
+        if (!GetAxisOverlap(vertical, GetMinAt(position), GetMaxAt(position), cellMin, cellMax, velocity.y, overlap)) {
+            return;
         }
 
-        if (this->Intersect(*collider)) {
-            float minXOverlap = GetMinHorizontalOverlap(collider);
-            float minYOverlap = GetMinVerticalOverlap(collider);
+        // Landing on the ground is left to the replay, like the callbacks
+        ResolveOverlap(vertical, overlap, position, velocity);
+
+        TileContact contact;
+        contact.overlap = overlap;
+        contact.cellMin = cellMin;
+        contact.cellMax = cellMax;
+        contact.cellIndex = index;
+        contact.position = position;
+        contact.velocity = velocity;
+        out.contacts.emplace_back(contact);
+    });
+}
 
-            // Fix for "seam" issue: If falling and hitting floor, prefer vertical resolution
-            float yBias = 1.0f;
-            if (rigidBody->GetVelocity().y > 0.0f && minYOverlap > 0.0f) {
-                yBias = 0.01f;
-            }
+void AABBColliderComponent::SweepTiles(bool vertical, RigidBodyComponent* rigidBody,
+                                       const Vector2& queryMin, const Vector2& queryMax, int firstCell)
+{
+    TileMapCollider* tileMap = GetGame()->GetTileMap();
+    if (!tileMap) {
+        return;
+    }
 
-            if (fabs(minYOverlap) * yBias <= fabs(minXOverlap)) {
-                if (!collider->IsTrigger()) {
-                    ResolveVerticalCollisions(rigidBody, minYOverlap);
-                }
-                mOwner->OnVerticalCollision(minYOverlap, collider);
-            }
+    int cellIndex = 0;
+    tileMap->ForEachSolidCell(queryMin, queryMax, [&](const Vector2& cellMin, const Vector2& cellMax) {
+        if (cellIndex++ < firstCell) {
+            return;
         }
-    }
 
-    return 0.0f;
+        float overlap;
+        if (!GetAxisOverlap(vertical, GetMin(), GetMax(), cellMin, cellMax, rigidBody->GetVelocity().y, overlap)) {
+            return;
+        }
+
+        ApplyResolution(vertical, rigidBody, overlap);
+        if (vertical) {
+            mOwner->OnVerticalCollision(overlap, tileMap->GetProxy(cellMin, cellMax));
+        }
+        else {
+            mOwner->OnHorizontalCollision(overlap, tileMap->GetProxy(cellMin, cellMax));
+        }
+    });
 }
 
-void AABBColliderComponent::ResolveHorizontalCollisions(RigidBodyComponent *rigidBody, const float minXOverlap)
+bool AABBColliderComponent::MatchesBox(const TilePassPrediction& tiles) const
 {
-    // Clamp overlap to avoid teleportation
-    float overlap = minXOverlap;
-    float maxOverlap = 32.0f; // Game::TILE_SIZE
-    if (overlap > maxOverlap) overlap = maxOverlap;
-    if (overlap < -maxOverlap) overlap = -maxOverlap;
+    return IsSame(tiles.offset, mOffset) && tiles.width == mWidth && tiles.height == mHeight;
+}
+
+void AABBColliderComponent::ReplayTiles(bool vertical, RigidBodyComponent* rigidBody, const TilePassPrediction& tiles)
+{
+    TileMapCollider* tileMap = GetGame()->GetTileMap();
+
+    // Something between Prepare and here (an earlier pass's callback, a
+    // dynamic collision) moved the body or changed its box: sweep for real
+    if (!tileMap || !MatchesBox(tiles) ||
+        !IsSame(tiles.startPosition, mOwner->GetPosition()) ||
+        !IsSame(tiles.startVelocity, rigidBody->GetVelocity())) {
+        Vector2 pad(static_cast<float>(Game::TILE_SIZE), static_cast<float>(Game::TILE_SIZE));
+        SweepTiles(vertical, rigidBody, GetMin() - pad, GetMax() + pad, 0);
+        return;
+    }
 
-    // Adjust position
-    Vector2 pos = mOwner->GetPosition();
-    pos.x -= overlap;
-    mOwner->SetPosition(pos);
+    for (const TileContact& contact : tiles.contacts) {
+        // The contact was found with the same rules from this same state, so
+        // resolving it again lands on contact.position (checked below)
+        ApplyResolution(vertical, rigidBody, contact.overlap);
 
-    // Zero out horizontal velocity
-    Vector2 vel = rigidBody->GetVelocity();
-    vel.x = 0.0f;
-    rigidBody->SetVelocity(vel);
+        AABBColliderComponent* proxy = tileMap->GetProxy(contact.cellMin, contact.cellMax);
+        if (vertical) {
+            mOwner->OnVerticalCollision(contact.overlap, proxy);
+        }
+        else {
+            mOwner->OnHorizontalCollision(contact.overlap, proxy);
+        }
+
+        // The callback may have moved the body; the rest of the prediction
+        // assumed it didn't, so the remaining cells are swept instead
+        if (!MatchesBox(tiles) ||
+            !IsSame(contact.position, mOwner->GetPosition()) ||
+            !IsSame(contact.velocity, rigidBody->GetVelocity())) {
+            SweepTiles(vertical, rigidBody, tiles.queryMin, tiles.queryMax, contact.cellIndex + 1);
+            return;
+        }
+    }
 }
 
-void AABBColliderComponent::ResolveVerticalCollisions(RigidBodyComponent *rigidBody, const float minYOverlap)
+void AABBColliderComponent::QueryNearbyColliders(FrameVector<AABBColliderComponent*>& out, float padding)
 {
-    // Clamp overlap to avoid teleportation
-    float overlap = minYOverlap;
-    float maxOverlap = 32.0f; // Game::TILE_SIZE
-    if (overlap > maxOverlap) overlap = maxOverlap;
-    if (overlap < -maxOverlap) overlap = -maxOverlap;
-
-    // Adjust position
-    Vector2 pos = mOwner->GetPosition();
-    pos.y -= overlap;
-    mOwner->SetPosition(pos);
-
-    // Zero out vertical velocity
-    Vector2 vel = rigidBody->GetVelocity();
-    vel.y = 0.0f;
-    rigidBody->SetVelocity(vel);
-
-    if (minYOverlap > 0) {
-        mOwner->SetOnGround();
-    }
+    SpatialHashGrid* grid = GetGame()->GetCollisionGrid();
+
+    // Make sure our own buckets reflect the position we are testing from
+    grid->Update(this);
+
+    // Resolution may push us up to one tile away, so pad the query to keep
+    // every collider the old full scan could have reached after a push
+    Vector2 pad(padding, padding);
+    grid->Query(GetMin() - pad, GetMax() + pad, out);
 }
 
 void AABBColliderComponent::SetSize(float width, float height)
 {
     mWidth = width;
     mHeight = height;
+    GetGame()->GetCollisionGrid()->Update(this);
 }
 
 void AABBColliderComponent::SetOffset(const Vector2& offset)
 {
     mOffset = offset;
+    GetGame()->GetCollisionGrid()->Update(this);
 }
 
 void AABBColliderComponent::DebugDraw(class Renderer *renderer)
@@ -217,11 +376,15 @@ void AABBColliderComponent::DebugDraw(class Renderer *renderer)
 
 void AABBColliderComponent::Update(float deltaTime)
 {
+    // Mantém o broadphase em dia caso o dono tenha sido movido sem física
+    GetGame()->GetCollisionGrid()->Update(this);
+
     // Só executamos essa lógica se for um TRIGGER e tiver um callback configurado
     if (mIsTrigger && mCollisionCallback)
     {
-        // Pega todos os colisores do jogo
-        auto colliders = GetGame()->GetColliders();
+        // Pega os colisores próximos
+        auto colliders = GetGame()->GetFrameArena()->MakeVector<AABBColliderComponent*>();
+        QueryNearbyColliders(colliders, 0.0f);
 
         for (auto collider : colliders)
         {
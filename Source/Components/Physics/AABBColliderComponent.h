@@ -6,6 +6,7 @@
 #include "../Component.h"
 #include "../../Math.h"
 #include "RigidBodyComponent.h"
+#include "../../Physics/SpatialHashGrid.h"
 #include <vector>
 #include <set>
 #include <functional>
@@ -27,15 +28,27 @@ enum class ColliderLayer
 class AABBColliderComponent : public Component
 {
 public:
+    COMPONENT_TYPE(AABBColliderComponent)
 
     AABBColliderComponent(class Actor* owner, int dx, int dy, int w, int h, ColliderLayer layer, 
                             bool isTrigger = false, bool isStatic = false, int updateOrder = 10);
     ~AABBColliderComponent() override;
 
+    // Pooled, so the collision sweep walks contiguous memory
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
     bool Intersect(const AABBColliderComponent& b) const;
 
-    float DetectHorizontalCollision(RigidBodyComponent *rigidBody);
-    float DetectVertialCollision(RigidBodyComponent *rigidBody);
+    // tiles: this axis' tile pass predicted by RigidBodyComponent::Prepare.
+    // Replayed if the body enters it as predicted, swept here otherwise
+    float DetectHorizontalCollision(RigidBodyComponent *rigidBody, const TilePassPrediction* tiles = nullptr);
+    float DetectVertialCollision(RigidBodyComponent *rigidBody, const TilePassPrediction* tiles = nullptr);
+
+    // Tile pass of one axis for this box at position, moving at velocity, on
+    // those copies: fills out and leaves them as the pass would. Changes
+    // nothing else, so job threads may run it for different bodies
+    void PredictTilePass(bool vertical, Vector2& position, Vector2& velocity, TilePassPrediction& out);
 
     Vector2 GetMin() const;
     Vector2 GetMax() const;
@@ -46,6 +59,7 @@ public:
     void SetOffset(const Vector2& offset);
 
     bool IsTrigger() const { return mIsTrigger; }
+    bool IsStatic() const { return mIsStatic; }
 
     // Drawing for debug purposes
     void DebugDraw(class Renderer* renderer) override;
@@ -55,12 +69,46 @@ public:
     // Função que será chamada pelo Game.cpp a cada frame para checar triggers
     void Update(float deltaTime) override;
 
+    void OnPoolRelease() override;
+    void OnPoolAcquire() override;
+
+    // Collider-vs-collider tests since the last call (perf overlay)
+    static int TakePairTestCount();
+
+    // The collision rules, on plain boxes and copies of a body's state, so
+    // the real passes, PredictTilePass and particles can't drift apart.
+    // Whether box a against box b resolves on this axis, and by how much
+    static bool GetAxisOverlap(bool vertical, const Vector2& aMin, const Vector2& aMax,
+                               const Vector2& bMin, const Vector2& bMax, float velocityY, float& overlap);
+    // Pushes position out by overlap (at most a tile) and stops velocity on
+    // that axis. True if that lands the owner on the ground
+    static bool ResolveOverlap(bool vertical, float overlap, Vector2& position, Vector2& velocity);
+
 private:
-    float GetMinVerticalOverlap(AABBColliderComponent* b) const;
-    float GetMinHorizontalOverlap(AABBColliderComponent* b) const;
+    friend class SpatialHashGrid;
+
+    // Collects the colliders around this one from the game's broadphase grid
+    void QueryNearbyColliders(FrameVector<AABBColliderComponent*>& out, float padding);
 
-    void ResolveHorizontalCollisions(RigidBodyComponent *rigidBody, const float minOverlap);
-    void ResolveVerticalCollisions(RigidBodyComponent *rigidBody, const float minOverlap);
+    // Same test against raw bounds
+    bool Intersect(const Vector2& bMin, const Vector2& bMax) const;
+    // ResolveOverlap on the owner and its body
+    void ApplyResolution(bool vertical, RigidBodyComponent* rigidBody, float overlap);
+
+    // Both Detect*Collision, for one axis
+    void DetectCollision(bool vertical, RigidBodyComponent* rigidBody, const TilePassPrediction* tiles);
+
+    // Box of this collider if the owner stood at position
+    Vector2 GetMinAt(const Vector2& position) const;
+    Vector2 GetMaxAt(const Vector2& position) const;
+
+    // Tile pass on the real body: the cells of [queryMin, queryMax] from
+    // firstCell on, resolving and calling back as it goes
+    void SweepTiles(bool vertical, RigidBodyComponent* rigidBody, const Vector2& queryMin, const Vector2& queryMax, int firstCell);
+    // Applies a predicted pass contact by contact, falling back to SweepTiles
+    // from where the body stops matching it (a callback moved it, say)
+    void ReplayTiles(bool vertical, RigidBodyComponent* rigidBody, const TilePassPrediction& tiles);
+    bool MatchesBox(const TilePassPrediction& tiles) const;
 
     Vector2 mOffset;
     int mWidth;
@@ -71,4 +119,8 @@ private:
     ColliderLayer mLayer;
 
     CollisionCallback mCollisionCallback;
+
+    BroadphaseProxy mBroadphase;
+
+    static int sPairTests;
 };
\ No newline at end of file
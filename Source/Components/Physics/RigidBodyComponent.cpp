@@ -7,11 +7,32 @@
 #include "../../Game.h"
 #include "RigidBodyComponent.h"
 #include "AABBColliderComponent.h"
+#include "../ComponentPool.h"
 
 const float MAX_SPEED_X = 700.0f;
 const float MAX_SPEED_Y = 1400.0f;
 const float GRAVITY = 1800.0f;
 
+namespace
+{
+    ComponentPool<sizeof(RigidBodyComponent)> sPool;
+
+    bool IsSame(const Vector2& a, const Vector2& b)
+    {
+        return a.x == b.x && a.y == b.y;
+    }
+}
+
+void* RigidBodyComponent::operator new(size_t size)
+{
+    return sPool.Allocate(size);
+}
+
+void RigidBodyComponent::operator delete(void* p, size_t size)
+{
+    sPool.Free(p, size);
+}
+
 RigidBodyComponent::RigidBodyComponent(class Actor* owner, float mass, float friction, bool applyGravity, int updateOrder)
         :Component(owner, updateOrder)
         ,mMass(mass)
@@ -20,7 +41,26 @@ RigidBodyComponent::RigidBodyComponent(class Actor* owner, float mass, float fri
         ,mVelocity(Vector2::Zero)
         ,mAcceleration(Vector2::Zero)
 {
+    GetGame()->AddRigidBody(this);
+}
 
+RigidBodyComponent::~RigidBodyComponent()
+{
+    GetGame()->RemoveRigidBody(this);
+}
+
+void RigidBodyComponent::OnPoolRelease()
+{
+    GetGame()->RemoveRigidBody(this);
+}
+
+void RigidBodyComponent::OnPoolAcquire()
+{
+    GetGame()->AddRigidBody(this);
+
+    mVelocity = Vector2::Zero;
+    mAcceleration = Vector2::Zero;
+    mPrediction.valid = false;
 }
 
 void RigidBodyComponent::ApplyForce(const Vector2 &force)
@@ -28,39 +68,115 @@ void RigidBodyComponent::ApplyForce(const Vector2 &force)
     mAcceleration += force * (1.f/mMass);
 }
 
-void RigidBodyComponent::Update(float deltaTime)
+void RigidBodyComponent::Integrate(float deltaTime, Vector2& outVelocity, Vector2& outAcceleration) const
 {
+    // Same operations, in the same order, as ApplyForce would do
+    Vector2 acceleration = mAcceleration;
+
     // Apply gravity acceleration
     if(mApplyGravity)
     {
-        ApplyForce(Vector2::UnitY * GRAVITY);
+        acceleration += Vector2::UnitY * GRAVITY * (1.f/mMass);
     }
 
     // Apply friction
     if(Math::Abs(mVelocity.x) > 0.05f && mFrictionCoefficient != 0.0f)
     {
-        ApplyForce(Vector2::UnitX * -mFrictionCoefficient * mVelocity.x);
+        acceleration += Vector2::UnitX * -mFrictionCoefficient * mVelocity.x * (1.f/mMass);
     }
 
     // Euler Integration
-    mVelocity += mAcceleration * deltaTime;
+    Vector2 velocity = mVelocity + acceleration * deltaTime;
+
+    velocity.x = Math::Clamp<float>(velocity.x, -MAX_SPEED_X, MAX_SPEED_X);
+    velocity.y = Math::Clamp<float>(velocity.y, -MAX_SPEED_Y, MAX_SPEED_Y);
+
+    if(Math::NearlyZero(velocity.x, 1.0f))
+    {
+        velocity.x = 0.f;
+    }
 
-    mVelocity.x = Math::Clamp<float>(mVelocity.x, -MAX_SPEED_X, MAX_SPEED_X);
-    mVelocity.y = Math::Clamp<float>(mVelocity.y, -MAX_SPEED_Y, MAX_SPEED_Y);
+    outVelocity = velocity;
+    outAcceleration = acceleration;
+}
 
-    if(Math::NearlyZero(mVelocity.x, 1.0f))
+void RigidBodyComponent::Prepare(float deltaTime)
+{
+    mPrediction.valid = false;
+    if (!IsEnabled() || mOwner->GetState() != ActorState::Active)
     {
-        mVelocity.x = 0.f;
+        return;
     }
 
+    // Only this body's actor is looked at, so bodies of different actors
+    // can be prepared at the same time. Game::PreparePhysics flushed every
+    // component table before dispatching, so this lookup doesn't write
     auto collider = mOwner->GetComponent<AABBColliderComponent>();
 
+    mPrediction.deltaTime = deltaTime;
+    mPrediction.position = mOwner->GetPosition();
+    mPrediction.velocity = mVelocity;
+    mPrediction.acceleration = mAcceleration;
+    mPrediction.applyGravity = mApplyGravity;
+    mPrediction.collider = collider;
+    mPrediction.colliderActive = collider && collider->IsEnabled() && !collider->IsStatic();
+
+    Vector2 velocity;
+    Integrate(deltaTime, velocity, mPrediction.nextAcceleration);
+    mPrediction.nextVelocity = velocity;
+
+    // Update's moves, on a copy: x then the horizontal tiles, y then the vertical ones
+    Vector2 position(mPrediction.position.x + velocity.x * deltaTime, mPrediction.position.y);
+    if (mPrediction.colliderActive)
+    {
+        collider->PredictTilePass(false, position, velocity, mPrediction.horizontal);
+    }
+
+    position = Vector2(position.x, position.y + velocity.y * deltaTime);
+    if (mPrediction.colliderActive)
+    {
+        collider->PredictTilePass(true, position, velocity, mPrediction.vertical);
+    }
+
+    mPrediction.valid = true;
+}
+
+bool RigidBodyComponent::MatchesPrediction(float deltaTime, AABBColliderComponent* collider) const
+{
+    return mPrediction.deltaTime == deltaTime &&
+           IsSame(mPrediction.position, mOwner->GetPosition()) &&
+           IsSame(mPrediction.velocity, mVelocity) &&
+           IsSame(mPrediction.acceleration, mAcceleration) &&
+           mPrediction.applyGravity == mApplyGravity &&
+           mPrediction.collider == collider &&
+           mPrediction.colliderActive == (collider && collider->IsEnabled() && !collider->IsStatic());
+}
+
+void RigidBodyComponent::Update(float deltaTime)
+{
+    auto collider = mOwner->GetComponent<AABBColliderComponent>();
+
+    // Prepared from exactly this state? Then the integration stands and the
+    // tile passes can be replayed (they check the state they start from)
+    bool predicted = mPrediction.valid && MatchesPrediction(deltaTime, collider);
+    mPrediction.valid = false;
+
+    if (predicted)
+    {
+        mVelocity = mPrediction.nextVelocity;
+        mAcceleration = mPrediction.nextAcceleration;
+    }
+    else
+    {
+        Integrate(deltaTime, mVelocity, mAcceleration);
+    }
+
     mOwner->SetPosition(Vector2(mOwner->GetPosition().x + mVelocity.x * deltaTime,
                                      mOwner->GetPosition().y));
 
     if (collider)
     {
-        collider->DetectHorizontalCollision(this);
+        collider->DetectHorizontalCollision(this, predicted ? &mPrediction.horizontal : nullptr);
     }
 
     mOwner->SetPosition(Vector2(mOwner->GetPosition().x,
@@ -68,7 +184,7 @@ void RigidBodyComponent::Update(float deltaTime)
 
     if (collider)
     {
-        collider->DetectVertialCollision(this);
+        collider->DetectVertialCollision(this, predicted ? &mPrediction.vertical : nullptr);
     }
 
     mAcceleration.Set(0.f, 0.f);
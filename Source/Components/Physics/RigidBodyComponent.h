@@ -3,18 +3,66 @@
 //
 
 #pragma once
+#include <vector>
 #include "../Component.h"
 #include "../../Math.h"
 
+// A tile map cell a tile pass resolved against, and the body's state right after
+struct TileContact
+{
+    float overlap;
+    Vector2 cellMin;
+    Vector2 cellMax;
+    // Position of the cell in the pass's visiting order
+    int cellIndex;
+    Vector2 position;
+    Vector2 velocity;
+};
+
+// One axis of tile map collision worked out ahead of time (see
+// RigidBodyComponent::Prepare), valid for a body entering it in this state
+struct TilePassPrediction
+{
+    Vector2 startPosition;
+    Vector2 startVelocity;
+    // Collider box it was computed with
+    Vector2 offset;
+    int width;
+    int height;
+    // Cells visited, fixed at the start of the pass
+    Vector2 queryMin;
+    Vector2 queryMax;
+    std::vector<TileContact> contacts;
+};
+
 class RigidBodyComponent : public Component
 {
 public:
+    COMPONENT_TYPE(RigidBodyComponent)
+
     // Lower update order to update first
     RigidBodyComponent(class Actor* owner, float mass = 1.0f, float friction = 0.0f,
                        bool applyGravity = true, int updateOrder = 10);
+    ~RigidBodyComponent() override;
+
+    // Pooled, so the physics sweep walks contiguous memory
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
 
     void Update(float deltaTime) override;
 
+    void OnPoolRelease() override;
+    // Also stops the body
+    void OnPoolAcquire() override;
+
+    // Physics in two steps (see Game::PreparePhysics). Prepare may run on a
+    // job thread: it integrates and finds the tile map hits on a copy of the
+    // body. Update then runs on the main thread, in the usual order. It
+    // replays that work if nothing touched the body in between, and otherwise
+    // computes it again. Either way positions, velocities and the order of
+    // the callbacks are the same as computing everything in Update
+    void Prepare(float deltaTime);
+
     const Vector2& GetVelocity() const { return mVelocity; }
     void SetVelocity(const Vector2& velocity) { mVelocity = velocity; }
 
@@ -26,6 +74,10 @@ public:
     void ApplyForce(const Vector2 &force);
 
 private:
+    // Gravity, friction and pending forces over one step, without touching the body
+    void Integrate(float deltaTime, Vector2& outVelocity, Vector2& outAcceleration) const;
+    bool MatchesPrediction(float deltaTime, class AABBColliderComponent* collider) const;
+
     bool mApplyGravity;
 
     // Physical properties
@@ -34,4 +86,26 @@ private:
 
     Vector2 mVelocity;
     Vector2 mAcceleration;
+
+    struct Prediction
+    {
+        bool valid = false;
+
+        // What it was computed from
+        float deltaTime = 0.0f;
+        Vector2 position;
+        Vector2 velocity;
+        Vector2 acceleration;
+        bool applyGravity = false;
+        class AABBColliderComponent* collider = nullptr;
+        bool colliderActive = false;
+
+        // Integrated
+        Vector2 nextVelocity;
+        Vector2 nextAcceleration;
+
+        TilePassPrediction horizontal;
+        TilePassPrediction vertical;
+    };
+    Prediction mPrediction;
 };
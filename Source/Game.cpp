@@ -14,12 +14,15 @@
 #include <filesystem>
 #include <iostream>
 #include "Components/Drawing/DrawComponent.h"
+#include "Components/Drawing/DrawableRegistry.h"
+#include "Components/Drawing/TileLayerRenderer.h"
 #include "Components/Physics/RigidBodyComponent.h"
 #include "Components/Drawing/AnimatorComponent.h"
 #include "Components/Physics/AABBColliderComponent.h"
 #include "Components/ParticleSystemComponent.h"
 #include "Random.h"
 #include "Actors/Actor.h"
+#include "Actors/ActorPool.h"
 #include "Actors/Block.h"
 #include "Actors/Goomba.h"
 #include "Actors/Policeman.h"
@@ -39,6 +42,7 @@
 #include "UI/Screens/InventoryScreen.h"
 #include "UI/Screens/LoadingScreen.h"
 #include "UI/HUD.h"
+#include "UI/PerfOverlay.h"
 #include "Actors/ParallaxActor.h"
 #include "Actors/PlayerBullet.h"
 #include "Actors/PolicemanBullet.h"
@@ -51,6 +55,16 @@
 #include "Actors/FinalFlower.h"
 #include "Actors/FlowerBoss.h"
 #include "Renderer/Font.h"
+#include "Physics/SpatialHashGrid.h"
+#include "Physics/TileMapCollider.h"
+#include "Particles/ParticleEngine.h"
+#include "Renderer/NullRenderer.h"
+#include "NullAudioSystem.h"
+#include "Replay/InputReplay.h"
+#include "Profiler.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/FrameArena.h"
+#include "Memory/SceneArena.h"
 
 // Atalho para facilitar leitura do JSON
 using json = nlohmann::json;
@@ -59,16 +73,46 @@ int Game::WINDOW_WIDTH = 1280;
 int Game::WINDOW_HEIGHT = 768;
 
 Game::Game()
-        :mWindow(nullptr)
+        :mHUD(nullptr)
+        ,mPerfOverlay(nullptr)
+        ,mShowPerfOverlay(false)
+        ,mLastPresentMs(0.0f)
+        ,mDrawables(nullptr)
+        ,mSystemUpdate(false)
+        ,mJobs(nullptr)
+        ,mWorkerCount(-1)
+        ,mFrameArena(nullptr)
+        ,mSceneArena(nullptr)
+        ,mIsUnloading(false)
+        ,mCollisionGrid(nullptr)
+        ,mParticleEngine(nullptr)
+        ,mWindow(nullptr)
         ,mRenderer(nullptr)
-        ,mTicksCount(0)
+        ,mLastCounter(0)
+        ,mAccumulator(0.0)
+        ,mTickRate(static_cast<float>(FPS))
+        ,mMaxCatchUpSteps(5)
+        ,mRenderAlpha(1.0f)
+        ,mPrevCameraPos(Vector2::Zero)
+        ,mHasPrevCamera(false)
+        ,mKeyState(nullptr)
+        ,mMouseX(0)
+        ,mMouseY(0)
+        ,mMouseButtons(0)
+        ,mTickIndex(0)
+        ,mRecorder(nullptr)
+        ,mReplay(nullptr)
+        ,mTraceFile("trace.json")
+        ,mDumpTraceOnExit(false)
         ,mIsRunning(true)
+        ,mIsHeadless(false)
         ,mIsDebugging(false)
-        ,mUpdatingActors(false)
         ,mCameraPos(Vector2::Zero)
         ,mZoomScale(1.0f)
         ,mPlayer(nullptr)
         ,mLevelData(nullptr)
+        ,mTileMap(nullptr)
+        ,mTileLayers(nullptr)
         ,mIsPlayerDead(false)
         ,mCoinCount(0)
         ,mState(GameState::Gameplay)
@@ -88,9 +132,29 @@ bool Game::Initialize()
 {
     Random::Init();
 
+    // A replay starts from exactly the state the recording did
+    if (mReplay)
+    {
+        const ReplayHeader& header = mReplay->GetHeader();
+        Random::Seed(header.seed);
+        SetTickRate(header.tickRate);
+        WINDOW_WIDTH = header.windowWidth;
+        WINDOW_HEIGHT = header.windowHeight;
+        mSystemUpdate = header.systemUpdate;
+    }
+
     mIsDebugging = false;
 
-    if (SDL_Init(SDL_INIT_VIDEO) != 0)
+    // First, so everything after it (scene loads included) can schedule jobs
+    mJobs = new JobSystem(mWorkerCount < 0 ? JobSystem::GetDefaultWorkerCount() : mWorkerCount);
+    mThinkCommands.resize(mJobs->GetWorkerCount() + 1);
+    SDL_Log("Job system: %d worker threads", mJobs->GetWorkerCount());
+    // Grows by itself if a frame needs more
+    mFrameArena = new FrameArena(256 * 1024);
+    // Also grows to fit the biggest level after loading it once
+    mSceneArena = new SceneArena(512 * 1024);
+
+    if (SDL_Init(mIsHeadless ? SDL_INIT_EVENTS : SDL_INIT_VIDEO) != 0)
     {
         SDL_Log("Unable to initialize SDL: %s", SDL_GetError());
         return false;
@@ -118,60 +182,90 @@ bool Game::Initialize()
         return false;
     }
 
-    // Initialize SDL_mixer
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) == -1)
+    mLevelWidth = 0.0f;
+    mLevelHeight = 0.0f;
+
+    // Headless: images are still decoded for their sizes and fonts still
+    // open, but there is no window, GL context or audio device
+    if (mIsHeadless)
     {
-        SDL_Log("Failed to initialize SDL_mixer");
-        return false;
+        mRenderer = new NullRenderer();
+        mRenderer->Initialize(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+        mAudio = new NullAudioSystem();
     }
+    else
+    {
+        // Initialize SDL_mixer
+        if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) == -1)
+        {
+            SDL_Log("Failed to initialize SDL_mixer");
+            return false;
+        }
+
+        // Get screen dimensions
+        SDL_DisplayMode dm;
+        if (!mReplay && SDL_GetDesktopDisplayMode(0, &dm) == 0) {
+            // Set window size to 90% of screen size to leave space for window bar
+            WINDOW_WIDTH = static_cast<int>(dm.w * 0.9f);
+            WINDOW_HEIGHT = static_cast<int>(dm.h * 0.9f);
+        }
+
+        mWindow = SDL_CreateWindow("Contra-Diction", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE);
+        if (!mWindow)
+        {
+            SDL_Log("Failed to create window: %s", SDL_GetError());
+            return false;
+        }
 
-    // Get screen dimensions
-    SDL_DisplayMode dm;
-    if (SDL_GetDesktopDisplayMode(0, &dm) == 0) {
-        // Set window size to 90% of screen size to leave space for window bar
-        WINDOW_WIDTH = static_cast<int>(dm.w * 0.9f);
-        WINDOW_HEIGHT = static_cast<int>(dm.h * 0.9f);
+        mRenderer = new Renderer(mWindow);
+        mRenderer->Initialize(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+        mAudio = new AudioSystem();
     }
 
-    mWindow = SDL_CreateWindow("Contra-Diction", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE);
-    if (!mWindow)
+    if (!mRecordFile.empty())
     {
-        SDL_Log("Failed to create window: %s", SDL_GetError());
-        return false;
+        ReplayHeader header;
+        header.seed = Random::GetSeed();
+        header.tickRate = mTickRate;
+        header.windowWidth = WINDOW_WIDTH;
+        header.windowHeight = WINDOW_HEIGHT;
+        header.systemUpdate = mSystemUpdate;
+
+        mRecorder = new InputRecorder();
+        if (!mRecorder->Open(mRecordFile, header))
+        {
+            delete mRecorder;
+            mRecorder = nullptr;
+        }
     }
 
-    mLevelWidth = 0.0f;
-    mLevelHeight = 0.0f;
-
-    mRenderer = new Renderer(mWindow);
-    mRenderer->Initialize(WINDOW_WIDTH, WINDOW_HEIGHT);
-
-    mAudio = new AudioSystem();
+    mDrawables = new DrawableRegistry();
+    mCollisionGrid = new SpatialHashGrid(static_cast<float>(TILE_SIZE));
+    mParticleEngine = new ParticleEngine(this);
 
     mHUD = new HUD(this);
+    if (!mIsHeadless)
+    {
+        mPerfOverlay = new PerfOverlay(this);
+    }
 
     PlayMusic("Menu.ogg");
 
     SetScene(GameScene::MainMenu);
 
-    mTicksCount = SDL_GetTicks();
+    mLastCounter = SDL_GetPerformanceCounter();
 
     return true;
 }
 
 void Game::UnloadScene()
 {
-    // 1. Marcar todos os atores para destruição
-    for (auto actor : mActors)
-    {
-        actor->SetState(ActorState::Destroy);
-    }
-    // Limpar lista de pendentes
-    mPendingActors.clear();
+    PROFILE_SCOPE("Game::UnloadScene");
 
-    // 2. Limpar Drawables e Colliders
-    mDrawables.clear();
-    mColliders.clear();
+    // Partículas podem guardar callbacks que apontam para atores
+    mParticleEngine->Clear();
 
     // Limpar UI Stack
     while (!mUIStack.empty()) {
@@ -179,23 +273,44 @@ void Game::UnloadScene()
         mUIStack.pop_back();
     }
 
-    // 3. Limpar dados do Level (IMPORTANTE para evitar vazamento de memória)
-    if (mLevelData)
-    {
-        // Precisamos saber a altura antiga para deletar corretamente.
-        // Assumindo que mLevelHeight foi configurado corretamente no BuildLevel.
-        int heightInTiles = static_cast<int>(mLevelHeight / Game::TILE_SIZE);
-
-        // Proteção extra: se mLevelHeight for 0 (primeira execução), não deleta nada
-        if (heightInTiles > 0) {
-            for (int i = 0; i < heightInTiles; ++i)
-            {
-                delete[] mLevelData[i];
-            }
-            delete[] mLevelData;
+    // 1. Destruir todos os atores agora, numa passada só. Os componentes não
+    // saem das listas um a um: as listas inteiras são esvaziadas logo abaixo
+    mIsUnloading = true;
+    mActors.ForEach([](Actor* actor) {
+        if (ActorPoolBase* pool = actor->GetPool())
+        {
+            pool->Release(actor);
         }
-        mLevelData = nullptr;
-    }
+        else
+        {
+            delete actor;
+        }
+    });
+    mActors.Compact();
+    mDeadActors.clear();
+    mDirtyComponentTables.clear();
+
+    // 2. Limpar Drawables e Colliders
+    mDrawables->Clear();
+    mColliders.Clear();
+    mRigidBodies.Clear();
+    mAnimators.Clear();
+    mParallaxActors.clear();
+    mCollisionGrid->Clear();
+    mIsUnloading = false;
+
+    // 3. Dados do Level: o grid vem da scene arena, liberado com ela
+    mLevelData = nullptr;
+
+    // O ator proxy do tilemap já foi destruído junto com os outros
+    delete mTileMap;
+    mTileMap = nullptr;
+
+    // Owned by its actor, already destroyed
+    mTileLayers = nullptr;
+
+    // Everything built for the scene is gone; its memory goes back in one go
+    mSceneArena->Reset();
 
     // 4. Resetar ponteiros de gameplay
     mPlayer = nullptr;
@@ -224,6 +339,9 @@ void Game::PerformLoad(GameScene scene)
     mPreviousScene = mCurrentScene;
     mCurrentScene = scene;
 
+    // Actors and components built below live exactly as long as the scene
+    SceneArena::Scope sceneScope(mSceneArena);
+
     switch (scene)
     {
         case GameScene::MainMenu:
@@ -425,28 +543,61 @@ void Game::PerformLoad(GameScene scene)
             new GameOver(this, "../Assets/Fonts/ALS_Micro_Bold.ttf", mPreviousScene);
             break;
     }
+
+    // Loading can take a while; don't make the new scene catch up on it,
+    // and don't interpolate the camera from where the old scene left it
+    mLastCounter = SDL_GetPerformanceCounter();
+    mAccumulator = 0.0;
+    mHasPrevCamera = false;
+
+    SDL_Log("Scene loaded: %d objects, %d KB in the scene arena",
+            mSceneArena->GetObjectCount(), static_cast<int>(mSceneArena->GetUsedBytes() / 1024));
 }
 
 // Removi LoadLevel e BuildLevel antigos para evitar confusão
 
 void Game::RunLoop()
 {
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+
     while (mIsRunning)
     {
-        float deltaTime = (SDL_GetTicks() - mTicksCount) / 1000.0f;
-        if (deltaTime > 0.05f)
+        Uint64 frameStart = SDL_GetPerformanceCounter();
+        double frameTime = static_cast<double>(frameStart - mLastCounter) / frequency;
+        mLastCounter = frameStart;
+
+        // Whatever the last frame left in the arena is garbage now
+        mFrameArena->Reset();
+
+        // Simulation always advances in steps of the same size. A slow frame
+        // runs at most mMaxCatchUpSteps ticks; anything beyond is dropped
+        const double step = 1.0 / mTickRate;
+        mAccumulator = std::min(mAccumulator + frameTime, step * mMaxCatchUpSteps);
+
+        ProcessInput();
+
+        while (mAccumulator >= step && mIsRunning)
         {
-            deltaTime = 0.05f;
+            SaveRenderState();
+            RunTick(static_cast<float>(step));
+            mAccumulator -= step;
         }
 
-        mTicksCount = SDL_GetTicks();
+        Uint64 updateEnd = SDL_GetPerformanceCounter();
 
-        ProcessInput();
-        UpdateGame(deltaTime);
+        mRenderAlpha = static_cast<float>(mAccumulator / step);
         GenerateOutput();
 
+        if (mPerfOverlay)
+        {
+            float updateMs = static_cast<float>(static_cast<double>(updateEnd - frameStart) * 1000.0 / frequency);
+            float outputMs = static_cast<float>(static_cast<double>(SDL_GetPerformanceCounter() - updateEnd) * 1000.0 / frequency);
+            mPerfOverlay->RecordFrame(updateMs, std::max(outputMs - mLastPresentMs, 0.0f), mLastPresentMs);
+        }
+
         // Cap frame rate
-        int sleepTime = (1000 / FPS) - (SDL_GetTicks() - mTicksCount);
+        double elapsedMs = static_cast<double>(SDL_GetPerformanceCounter() - frameStart) * 1000.0 / frequency;
+        int sleepTime = static_cast<int>((1000.0 / FPS) - elapsedMs);
         if (sleepTime > 0)
         {
             SDL_Delay(sleepTime);
@@ -454,95 +605,310 @@ void Game::RunLoop()
     }
 }
 
+void Game::RunHeadless(GameScene scene, int ticks)
+{
+    // Straight into the scene: no fade, no loading screen
+    mFadeState = FadeState::None;
+    mIsLoading = false;
+    PerformLoad(scene);
+
+    RunUncapped(ticks);
+}
+
+void Game::RunReplay(int maxTicks)
+{
+    RunUncapped(maxTicks);
+}
+
+void Game::RunUncapped(int ticks)
+{
+    const float step = 1.0f / mTickRate;
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    int tick = 0;
+    while (tick < ticks && mIsRunning)
+    {
+        mFrameArena->Reset();
+        ProcessInput();
+        RunTick(step);
+        tick++;
+    }
+
+    double seconds = static_cast<double>(SDL_GetPerformanceCounter() - start) / frequency;
+    SDL_Log("%d ticks in %.3f s (%.1f ticks/s, %.3f ms/tick), %d actors",
+            tick, seconds, seconds > 0.0 ? tick / seconds : 0.0,
+            tick > 0 ? seconds * 1000.0 / tick : 0.0, static_cast<int>(mActors.GetCount()));
+}
+
+void Game::RunTick(float deltaTime)
+{
+    PROFILE_SCOPE("Game::RunTick");
+
+    if (mReplay)
+    {
+        const InputFrame* frame = mReplay->ReadTick();
+        if (!frame)
+        {
+            SDL_Log("Replay finished after %llu ticks", static_cast<unsigned long long>(mTickIndex));
+            Quit();
+            return;
+        }
+
+        for (const auto& event : frame->events)
+        {
+            HandleEvent(event);
+        }
+
+        mKeyState = frame->keys.data();
+        mMouseX = frame->mouseX;
+        mMouseY = frame->mouseY;
+        mMouseButtons = frame->mouseButtons;
+    }
+    else
+    {
+        mKeyState = SDL_GetKeyboardState(nullptr);
+        mMouseButtons = SDL_GetMouseState(&mMouseX, &mMouseY);
+
+        if (mRecorder)
+        {
+            mRecorder->RecordTick(mKeyState, mMouseX, mMouseY, mMouseButtons);
+        }
+    }
+
+    ProcessActorInput();
+    UpdateGame(deltaTime);
+
+    if (mReplay)
+    {
+        mReplay->LogStateHash(mTickIndex, ComputeStateHash());
+    }
+    mTickIndex++;
+}
+
+uint64_t Game::ComputeStateHash() const
+{
+    // FNV-1a over what drifts first when a play-through diverges
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+
+    int scene = static_cast<int>(mCurrentScene);
+    uint32_t actorCount = static_cast<uint32_t>(mActors.GetCount());
+    mix(&scene, sizeof(scene));
+    mix(&actorCount, sizeof(actorCount));
+
+    if (mPlayer)
+    {
+        Vector2 position = mPlayer->GetPosition();
+        mix(&position.x, sizeof(position.x));
+        mix(&position.y, sizeof(position.y));
+    }
+
+    return hash;
+}
+
+void Game::SetTraceFile(const std::string& fileName)
+{
+    mTraceFile = std::filesystem::absolute(fileName).string();
+    mDumpTraceOnExit = true;
+}
+
+void Game::SetRecordFile(const std::string& fileName)
+{
+    // Initialize moves the working directory, so pin the path first
+    mRecordFile = std::filesystem::absolute(fileName).string();
+}
+
+bool Game::SetReplayFile(const std::string& fileName, const std::string& hashFileName)
+{
+    delete mReplay;
+    mReplay = new InputReplay();
+
+    if (!mReplay->Open(fileName) || !mReplay->OpenHashLog(hashFileName))
+    {
+        delete mReplay;
+        mReplay = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool Game::SceneFromName(const std::string& name, GameScene& outScene)
+{
+    static const std::map<std::string, GameScene> scenes = {
+        {"MainMenu", GameScene::MainMenu},
+        {"Level1", GameScene::Level1},
+        {"Level2", GameScene::Level2},
+        {"Level3", GameScene::Level3},
+        {"TestLevel", GameScene::TestLevel},
+        {"FinalLevel", GameScene::FinalLevel},
+        {"GameOver", GameScene::GameOver}
+    };
+
+    auto iter = scenes.find(name);
+    if (iter == scenes.end())
+    {
+        return false;
+    }
+
+    outScene = iter->second;
+    return true;
+}
+
+void Game::SetTickRate(float ticksPerSecond)
+{
+    mTickRate = ticksPerSecond < 1.0f ? 1.0f : ticksPerSecond;
+}
+
+void Game::SaveRenderState()
+{
+    mActors.ForEach([](Actor* actor) {
+        actor->SavePreviousTransform();
+    });
+
+    mPrevCameraPos = mCameraPos;
+    mHasPrevCamera = true;
+}
+
 void Game::ProcessInput()
 {
+    PROFILE_SCOPE("Game::ProcessInput");
+
     SDL_Event event;
     while (SDL_PollEvent(&event))
     {
-        switch (event.type)
+        // While replaying, input comes from the file; only closing the window counts
+        if (mReplay)
         {
-            case SDL_QUIT:
+            if (event.type == SDL_QUIT)
+            {
                 Quit();
-                break;
-            case SDL_MOUSEMOTION:
-                if (!mUIStack.empty())
-                {
-                    mUIStack.back()->HandleMouseMove(Vector2(static_cast<float>(event.motion.x), static_cast<float>(event.motion.y)));
-                }
-                break;
-            case SDL_MOUSEWHEEL:
-                if (mState == GameState::Gameplay)
-                {
-                    if (event.wheel.y > 0) // Scroll up
-                    {
-                        mZoomScale += 0.1f;
-                    }
-                    else if (event.wheel.y < 0) // Scroll down
-                    {
-                        mZoomScale -= 0.1f;
-                    }
-                    mZoomScale = std::clamp(mZoomScale, MIN_ZOOM, MAX_ZOOM);
-                }
-                break;
-            case SDL_MOUSEBUTTONDOWN:
-                if (!mUIStack.empty())
-                {
-                    if (event.button.button == SDL_BUTTON_LEFT)
-                    {
-                        mUIStack.back()->HandleMouseClick(Vector2(static_cast<float>(event.button.x), static_cast<float>(event.button.y)));
-                    }
-                }
-                break;
-            case SDL_KEYDOWN:
-                if (!mUIStack.empty())
-                {
-                    mUIStack.back()->HandleKeyPress(event.key.keysym.sym);
-                }
-                else if (event.key.keysym.sym == SDLK_ESCAPE && mState == GameState::Gameplay)
+            }
+            continue;
+        }
+
+        if (mRecorder)
+        {
+            mRecorder->RecordEvent(event);
+        }
+
+        HandleEvent(event);
+    }
+}
+
+void Game::HandleEvent(const SDL_Event& event)
+{
+    switch (event.type)
+    {
+        case SDL_QUIT:
+            Quit();
+            break;
+        case SDL_MOUSEMOTION:
+            if (!mUIStack.empty())
+            {
+                mUIStack.back()->HandleMouseMove(Vector2(static_cast<float>(event.motion.x), static_cast<float>(event.motion.y)));
+            }
+            break;
+        case SDL_MOUSEWHEEL:
+            if (mState == GameState::Gameplay)
+            {
+                if (event.wheel.y > 0) // Scroll up
                 {
-                    new PauseMenu(this, "../Assets/Fonts/ALS_Micro_Bold.ttf", mCurrentScene);
+                    mZoomScale += 0.1f;
                 }
-                else if (event.key.keysym.sym == SDLK_TAB && mState == GameState::Gameplay)
+                else if (event.wheel.y < 0) // Scroll down
                 {
-                    new InventoryScreen(this);
+                    mZoomScale -= 0.1f;
                 }
-                else if (event.key.keysym.sym == SDLK_F11)
+                mZoomScale = std::clamp(mZoomScale, MIN_ZOOM, MAX_ZOOM);
+            }
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+            if (!mUIStack.empty())
+            {
+                if (event.button.button == SDL_BUTTON_LEFT)
                 {
-                    Uint32 flags = SDL_GetWindowFlags(mWindow);
-                    if (flags & SDL_WINDOW_FULLSCREEN_DESKTOP)
-                    {
-                        SDL_SetWindowFullscreen(mWindow, 0);
-                    }
-                    else
-                    {
-                        SDL_SetWindowFullscreen(mWindow, SDL_WINDOW_FULLSCREEN_DESKTOP);
-                    }
+                    mUIStack.back()->HandleMouseClick(Vector2(static_cast<float>(event.button.x), static_cast<float>(event.button.y)));
                 }
-                else if ((event.key.keysym.sym == SDLK_EQUALS || event.key.keysym.sym == SDLK_KP_PLUS) && mState == GameState::Gameplay)
+            }
+            break;
+        case SDL_KEYDOWN:
+            if (!mUIStack.empty())
+            {
+                mUIStack.back()->HandleKeyPress(event.key.keysym.sym);
+            }
+            else if (event.key.keysym.sym == SDLK_ESCAPE && mState == GameState::Gameplay)
+            {
+                new PauseMenu(this, "../Assets/Fonts/ALS_Micro_Bold.ttf", mCurrentScene);
+            }
+            else if (event.key.keysym.sym == SDLK_TAB && mState == GameState::Gameplay)
+            {
+                new InventoryScreen(this);
+            }
+            else if (event.key.keysym.sym == SDLK_F3)
+            {
+                mShowPerfOverlay = !mShowPerfOverlay;
+            }
+            else if (event.key.keysym.sym == SDLK_F9)
+            {
+                Profiler::DumpChromeTrace(mTraceFile, TRACE_SECONDS);
+            }
+            else if (event.key.keysym.sym == SDLK_F11 && mWindow)
+            {
+                Uint32 flags = SDL_GetWindowFlags(mWindow);
+                if (flags & SDL_WINDOW_FULLSCREEN_DESKTOP)
                 {
-                    mZoomScale += 0.1f;
-                    mZoomScale = std::clamp(mZoomScale, MIN_ZOOM, MAX_ZOOM);
+                    SDL_SetWindowFullscreen(mWindow, 0);
                 }
-                else if ((event.key.keysym.sym == SDLK_MINUS || event.key.keysym.sym == SDLK_KP_MINUS) && mState == GameState::Gameplay)
+                else
                 {
-                    mZoomScale -= 0.1f;
-                    mZoomScale = std::clamp(mZoomScale, MIN_ZOOM, MAX_ZOOM);
+                    SDL_SetWindowFullscreen(mWindow, SDL_WINDOW_FULLSCREEN_DESKTOP);
                 }
-                break;
-        }
+            }
+            else if ((event.key.keysym.sym == SDLK_EQUALS || event.key.keysym.sym == SDLK_KP_PLUS) && mState == GameState::Gameplay)
+            {
+                mZoomScale += 0.1f;
+                mZoomScale = std::clamp(mZoomScale, MIN_ZOOM, MAX_ZOOM);
+            }
+            else if ((event.key.keysym.sym == SDLK_MINUS || event.key.keysym.sym == SDLK_KP_MINUS) && mState == GameState::Gameplay)
+            {
+                mZoomScale -= 0.1f;
+                mZoomScale = std::clamp(mZoomScale, MIN_ZOOM, MAX_ZOOM);
+            }
+            break;
     }
+}
 
-    const Uint8* state = SDL_GetKeyboardState(nullptr);
-
+// Keyboard state goes to the actors once per tick, so key edges they track
+// always pair with exactly one update
+void Game::ProcessActorInput()
+{
     if (mState == GameState::Gameplay)  {
-        for (auto actor : mActors) {
-            actor->ProcessInput(state);
-        }
+        mActors.ForEach([this](Actor* actor) {
+            actor->ProcessInput(mKeyState);
+        });
     }
 }
 
+Uint32 Game::GetMouseState(int* x, int* y) const
+{
+    if (x) *x = mMouseX;
+    if (y) *y = mMouseY;
+    return mMouseButtons;
+}
+
 void Game::UpdateGame(float deltaTime)
 {
+    PROFILE_SCOPE("Game::UpdateGame");
+
     if (mFadeState == FadeState::FadeOut)
     {
         mFadeTimer += deltaTime;
@@ -596,8 +962,8 @@ void Game::UpdateGame(float deltaTime)
             delete it->texture;
             it = mFloatingTexts.erase(it);
         } else {
-            if (it->owner) {
-                it->pos = it->owner->GetPosition();
+            if (Actor* owner = mActors.Get(it->owner)) {
+                it->pos = owner->GetPosition();
             }
             ++it;
         }
@@ -634,36 +1000,148 @@ void Game::UpdateUI(float deltaTime)
 
 void Game::UpdateActors(float deltaTime)
 {
-    mUpdatingActors = true;
-    for (auto actor : mActors)
+    PROFILE_SCOPE("Game::UpdateActors");
+
+    // Re-bucket anything that was moved outside of the physics step
+    mCollisionGrid->UpdateDynamic();
+
+    // Close the holes left by actors and components deleted last update
+    mActors.Compact();
+    mColliders.Compact();
+    mRigidBodies.Compact();
+    mAnimators.Compact();
+
+    PreparePhysics(deltaTime);
+
+    if (mSystemUpdate)
     {
-        actor->Update(deltaTime);
+        UpdateSystems(deltaTime);
     }
-    mUpdatingActors = false;
-
-    for (auto pending : mPendingActors)
+    else
     {
-        mActors.emplace_back(pending);
+        // Actors spawned during the traversal wait for the next update
+        mActors.ForEach([deltaTime](Actor* actor) {
+            actor->Update(deltaTime);
+        });
     }
-    mPendingActors.clear();
 
-    std::vector<Actor*> deadActors;
-    for (auto actor : mActors)
+    ThinkActors(deltaTime);
+
+    // Particles may kill actors through their callbacks, so before the sweep below
+    mParticleEngine->Update(deltaTime);
+
+    // Only the actors marked Destroy, no scan. By index: a destructor may
+    // mark more; handles of actors someone already deleted resolve to null
+    for (size_t i = 0; i < mDeadActors.size(); i++)
     {
-        if (actor->GetState() == ActorState::Destroy)
+        Actor* actor = mActors.Get(mDeadActors[i]);
+        if (actor && actor->GetState() == ActorState::Destroy)
         {
-            deadActors.emplace_back(actor);
+            if (ActorPoolBase* pool = actor->GetPool())
+            {
+                pool->Release(actor);
+            }
+            else
+            {
+                delete actor;
+            }
         }
     }
+    mDeadActors.clear();
+}
 
-    for (auto actor : deadActors)
-    {
-        delete actor;
-    }
+void Game::UpdateSystems(float deltaTime)
+{
+    PROFILE_SCOPE("Game::UpdateSystems");
+
+    // Same rule as the per-actor path: nothing created during this update
+    // runs until the next one, so every sweep stops where its list ended now
+    size_t numActors = mActors.GetSize();
+    size_t numBodies = mRigidBodies.GetSize();
+    size_t numColliders = mColliders.GetSize();
+    size_t numAnimators = mAnimators.GetSize();
+
+    auto isLive = [](Component* component) {
+        return component->IsEnabled() && component->GetOwner()->GetState() == ActorState::Active;
+    };
+
+    // Integration and resolution against the tile map and other colliders.
+    // Within an actor the body (update order 10) already ran before its
+    // collider and animator, so that relative order is kept
+    mRigidBodies.ForEach([&](RigidBodyComponent* body) {
+        if (isLive(body))
+        {
+            body->Update(deltaTime);
+        }
+    }, numBodies);
+
+    // Broadphase refresh and trigger callbacks, after every body moved
+    mColliders.ForEach([&](AABBColliderComponent* collider) {
+        if (isLive(collider))
+        {
+            collider->Update(deltaTime);
+        }
+    }, numColliders);
+
+    mAnimators.ForEach([&](AnimatorComponent* animator) {
+        if (isLive(animator))
+        {
+            animator->Update(deltaTime);
+        }
+    }, numAnimators);
+
+    mActors.ForEach([deltaTime](Actor* actor) {
+        actor->UpdateRemaining(deltaTime);
+    }, numActors);
+}
+
+void Game::ThinkActors(float deltaTime)
+{
+    PROFILE_SCOPE("Game::ThinkActors");
+
+    // Nothing is added, removed or moved until the commands are applied, so
+    // every thread sees the world as the regular update left it
+    FlushComponentTables();
+    size_t numActors = mActors.GetSize();
+    mJobs->ParallelFor("Game::ThinkActors", numActors, 64, [this, deltaTime](size_t begin, size_t end) {
+        ActorCommands& commands = mThinkCommands[mJobs->GetThreadIndex()];
+        for (size_t i = begin; i < end; i++)
+        {
+            Actor* actor = mActors.GetAt(i);
+            if (actor && actor->Thinks())
+            {
+                commands.SetOrder(static_cast<uint32_t>(i));
+                actor->Think(deltaTime, commands);
+            }
+        }
+    });
+
+    ActorCommands::ApplyAll(mThinkCommands, this);
+}
+
+void Game::PreparePhysics(float deltaTime)
+{
+    PROFILE_SCOPE("Game::PreparePhysics");
+
+    // Each body reads only its own actor and the tile map, and writes only
+    // its prediction. Flushed first, so finding the collider is a plain read
+    FlushComponentTables();
+    size_t numBodies = mRigidBodies.GetSize();
+    mJobs->ParallelFor("Game::PreparePhysics", numBodies, 32, [this, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (RigidBodyComponent* body = mRigidBodies.GetAt(i))
+            {
+                body->Prepare(deltaTime);
+            }
+        }
+    });
 }
 
 void Game::UpdateCamera()
 {
+    PROFILE_SCOPE("Game::UpdateCamera");
+
     if (!mPlayer) return;
 
     float zoom = mUIStack.empty() ? mZoomScale : 1.0f;
@@ -698,40 +1176,38 @@ void Game::UpdateCamera()
     mCameraPos.x = std::clamp(targetX, 0.0f, maxScrollX);
 }
 
-void Game::AddActor(Actor* actor)
+ActorHandle Game::AddActor(Actor* actor)
 {
-    if (mUpdatingActors)
-    {
-        mPendingActors.emplace_back(actor);
-    }
-    else
-    {
-        mActors.emplace_back(actor);
-    }
+    return mActors.Add(actor);
 }
 
 void Game::RemoveActor(Actor* actor)
 {
-    // Clear owner from floating texts
-    for (auto& ft : mFloatingTexts) {
-        if (ft.owner == actor) {
-            ft.owner = nullptr;
-        }
-    }
+    // Floating texts and other weak references see the stale handle on their own
+    mActors.Remove(actor->GetHandle());
+}
 
-    auto iter = std::find(mPendingActors.begin(), mPendingActors.end(), actor);
-    if (iter != mPendingActors.end())
-    {
-        std::iter_swap(iter, mPendingActors.end() - 1);
-        mPendingActors.pop_back();
-    }
+void Game::AddDeadActor(Actor* actor)
+{
+    mDeadActors.emplace_back(actor->GetHandle());
+}
+
+void Game::AddDirtyComponentTable(Actor* actor)
+{
+    mDirtyComponentTables.emplace_back(actor->GetHandle());
+}
 
-    iter = std::find(mActors.begin(), mActors.end(), actor);
-    if (iter != mActors.end())
+void Game::FlushComponentTables()
+{
+    // Handles of actors deleted since they were queued resolve to null
+    for (ActorHandle handle : mDirtyComponentTables)
     {
-        std::iter_swap(iter, mActors.end() - 1);
-        mActors.pop_back();
+        if (Actor* actor = mActors.Get(handle))
+        {
+            actor->FlushComponentTable();
+        }
     }
+    mDirtyComponentTables.clear();
 }
 
 void Game::AddParallaxActor(ParallaxActor* actor)
@@ -741,6 +1217,11 @@ void Game::AddParallaxActor(ParallaxActor* actor)
 
 void Game::RemoveParallaxActor(ParallaxActor* actor)
 {
+    if (mIsUnloading)
+    {
+        return;
+    }
+
     auto iter = std::find(mParallaxActors.begin(), mParallaxActors.end(), actor);
     if (iter != mParallaxActors.end())
     {
@@ -750,45 +1231,91 @@ void Game::RemoveParallaxActor(ParallaxActor* actor)
 
 void Game::AddDrawable(class DrawComponent *drawable)
 {
-    mDrawables.emplace_back(drawable);
-
-    std::stable_sort(mDrawables.begin(), mDrawables.end(),[](DrawComponent* a, DrawComponent* b) {
-        return a->GetDrawOrder() < b->GetDrawOrder();
-    });
+    mDrawables->Add(drawable);
 }
 
 void Game::RemoveDrawable(class DrawComponent *drawable)
 {
-    auto iter = std::find(mDrawables.begin(), mDrawables.end(), drawable);
-    if (iter != mDrawables.end()) {
-        mDrawables.erase(iter);
+    if (mIsUnloading)
+    {
+        return;
     }
+
+    mDrawables->Remove(drawable);
 }
 
 void Game::AddCollider(class AABBColliderComponent* collider)
 {
-    mColliders.emplace_back(collider);
+    mColliders.Add(collider);
+    mCollisionGrid->Insert(collider, !collider->IsStatic());
 }
 
 void Game::RemoveCollider(AABBColliderComponent* collider)
 {
-    auto iter = std::find(mColliders.begin(), mColliders.end(), collider);
-    if (iter != mColliders.end()) {
-        mColliders.erase(iter);
+    if (mIsUnloading)
+    {
+        return;
     }
+
+    mCollisionGrid->Remove(collider);
+    mColliders.Remove(collider);
+}
+
+void Game::AddRigidBody(RigidBodyComponent* body)
+{
+    mRigidBodies.Add(body);
+}
+
+void Game::RemoveRigidBody(RigidBodyComponent* body)
+{
+    if (mIsUnloading)
+    {
+        return;
+    }
+
+    mRigidBodies.Remove(body);
+}
+
+void Game::AddAnimator(AnimatorComponent* animator)
+{
+    mAnimators.Add(animator);
+}
+
+void Game::RemoveAnimator(AnimatorComponent* animator)
+{
+    if (mIsUnloading)
+    {
+        return;
+    }
+
+    mAnimators.Remove(animator);
 }
 
 void Game::GenerateOutput()
 {
+    PROFILE_SCOPE("Game::GenerateOutput");
+
     mRenderer->Clear();
 
+    // Draw everything mRenderAlpha of the way between the last two ticks;
+    // the simulated transforms are put back before returning
+    mActors.ForEach([this](Actor* actor) {
+        actor->ApplyInterpolatedTransform(mRenderAlpha);
+    });
+
+    Vector2 simCameraPos = mCameraPos;
+    if (mHasPrevCamera)
+    {
+        mCameraPos = Vector2::Lerp(mPrevCameraPos, mCameraPos, mRenderAlpha);
+    }
+
     float zoom = mUIStack.empty() ? mZoomScale : 1.0f;
     mRenderer->SetZoom(zoom);
 
-    // Setup Lighting
-    std::vector<Vector2> lightPositions;
-    std::vector<float> lightRadii;
-    std::vector<Vector3> lightColors;
+    // Setup Lighting (Light.frag takes up to 16)
+    auto lightPositions = mFrameArena->MakeVector<Vector2>(16);
+    auto lightRadii = mFrameArena->MakeVector<float>(16);
+    auto lightColors = mFrameArena->MakeVector<Vector3>(16);
 
     if (mPlayer)
     {
@@ -797,31 +1324,36 @@ void Game::GenerateOutput()
         lightColors.push_back(Vector3(1.0f, 1.0f, 1.0f));
     }
 
-    for (auto actor : mActors)
-    {
+    mActors.ForEach([&](Actor* actor) {
         if (dynamic_cast<PlayerBullet*>(actor) || dynamic_cast<PolicemanBullet*>(actor))
         {
             lightPositions.push_back(actor->GetPosition());
             lightRadii.push_back(100.0f);
             lightColors.push_back(Vector3(1.0f, 1.0f, 1.0f));
         }
-        else if (dynamic_cast<Particle*>(actor))
-        {
-            // Only add light if particle is active (visible)
-            if (actor->GetState() == ActorState::Active)
-            {
-                lightPositions.push_back(actor->GetPosition());
-                lightRadii.push_back(100.0f);
-                lightColors.push_back(Vector3(1.0f, 1.0f, 0.0f)); // Yellow tint
-            }
-        }
-    }
+    });
+
+    // Light.frag only takes the first 16 lights, no point in walking every particle
+    mParticleEngine->CollectLights(lightPositions, lightRadii, lightColors, 16);
 
     mRenderer->SetLightUniforms(lightPositions, lightRadii, lightColors, mAmbientLight);
     // SetLightUniforms sets the active shader to LightShader
 
-    for (auto drawable : mDrawables)
+    // Visible world rectangle, with some slack for the vegetation wiggle and outlines
+    const float cullMargin = 32.0f;
+    Vector2 viewMin = mCameraPos - Vector2(cullMargin, cullMargin);
+    Vector2 viewMax = mCameraPos + Vector2(WINDOW_WIDTH / zoom + cullMargin, WINDOW_HEIGHT / zoom + cullMargin);
+
+    mDrawables->ForEach([&](DrawComponent* drawable)
     {
+        Vector2 boundsMin, boundsMax;
+        if (drawable->GetWorldBounds(boundsMin, boundsMax) &&
+            (boundsMax.x < viewMin.x || boundsMin.x > viewMax.x ||
+             boundsMax.y < viewMin.y || boundsMin.y > viewMax.y))
+        {
+            return;
+        }
+
         drawable->Draw(mRenderer);
 
         if(mIsDebugging)
@@ -831,7 +1363,7 @@ void Game::GenerateOutput()
                 comp->DebugDraw(mRenderer);
               }
         }
-    }
+    });
 
     // Switch back to base shader for UI and Floating Text
     mRenderer->SetActiveShader(mRenderer->GetBaseShader());
@@ -873,7 +1405,21 @@ void Game::GenerateOutput()
         mRenderer->DrawRect(Vector2(WINDOW_WIDTH/2.0f, WINDOW_HEIGHT/2.0f), Vector2(static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT)), 0.0f, Vector3(0.0f, 0.0f, 0.0f), Vector2::Zero, RendererMode::TRIANGLES, alpha);
     }
 
+    // Drawn last so it stays readable over menus and fades
+    if (mPerfOverlay && mShowPerfOverlay)
+    {
+        mPerfOverlay->Draw(mRenderer);
+    }
+
+    mCameraPos = simCameraPos;
+    mActors.ForEach([](Actor* actor) {
+        actor->RestoreSimulatedTransform();
+    });
+
+    Uint64 presentStart = SDL_GetPerformanceCounter();
     mRenderer->Present();
+    mLastPresentMs = static_cast<float>(static_cast<double>(SDL_GetPerformanceCounter() - presentStart) * 1000.0 /
+                                        static_cast<double>(SDL_GetPerformanceFrequency()));
 }
 
 void Game::AddFloatingText(const Vector2& pos, const std::string& text, float duration, class Actor* owner)
@@ -888,7 +1434,7 @@ void Game::AddFloatingText(const Vector2& pos, const std::string& text, float du
             ft.duration = duration;
             ft.timer = 0.0f;
             ft.texture = tex;
-            ft.owner = owner;
+            ft.owner = owner ? owner->GetHandle() : ActorHandle();
             mFloatingTexts.push_back(ft);
         }
     }
@@ -900,19 +1446,19 @@ void Game::OnNPCKilled(Actor* actor)
     if (!mPlayer || mIsPlayerDead) return;
 
     // Spawn a flock of 4-5 drones
-    int count = 4 + (rand() % 2); // 4 or 5
+    int count = 4 + Random::GetIntRange(0, 1); // 4 or 5
     
     Vector2 playerPos = mPlayer->GetPosition();
     
     // Spawn them off-screen (top-right or top-left depending on player direction or random)
     // Let's spawn them high up and slightly ahead or behind
-    float spawnX = playerPos.x + (rand() % 2 == 0 ? 600.0f : -600.0f);
+    float spawnX = playerPos.x + (Random::GetIntRange(0, 1) == 0 ? 600.0f : -600.0f);
     float spawnY = playerPos.y - 200.0f; // Lower spawn height (was 500.0f)
 
     for (int i = 0; i < count; ++i) {
         auto* drone = new RobotFlyer(this);
         // Add some randomness to initial position
-        Vector2 offset(static_cast<float>(rand() % 100 - 50), static_cast<float>(rand() % 100 - 50));
+        Vector2 offset(static_cast<float>(Random::GetIntRange(0, 99) - 50), static_cast<float>(Random::GetIntRange(0, 99) - 50));
         drone->SetPosition(Vector2(spawnX, spawnY) + offset);
         
         // Force activation if needed, or rely on distance check
@@ -925,11 +1471,36 @@ void Game::OnNPCKilled(Actor* actor)
 
 void Game::Shutdown()
 {
-    UnloadScene(); // Limpa a cena atual
+    if (mDumpTraceOnExit)
+    {
+        Profiler::DumpChromeTrace(mTraceFile, TRACE_SECONDS);
+    }
 
-    while (!mActors.empty()) {
-        delete mActors.back();
+    // Limpa a cena atual: destrói todos os atores, pooled ones go to their pools
+    UnloadScene();
+
+    // What the pools kept; their actors still need the lists deleted below
+    for (ActorPoolBase* pool : mActorPools)
+    {
+        SDL_Log("Actor pool %s: peak %d alive, %d created", pool->GetName(), pool->GetPeakCount(), pool->GetCreatedCount());
+        pool->Clear();
     }
+    mActorPools.clear();
+
+    delete mCollisionGrid;
+    mCollisionGrid = nullptr;
+
+    delete mParticleEngine;
+    mParticleEngine = nullptr;
+
+    delete mDrawables;
+    mDrawables = nullptr;
+
+    delete mRecorder;
+    mRecorder = nullptr;
+
+    delete mReplay;
+    mReplay = nullptr;
 
     if (mAudio) {
         delete mAudio;
@@ -941,26 +1512,42 @@ void Game::Shutdown()
         mHUD = nullptr;
     }
 
+    if (mPerfOverlay) {
+        delete mPerfOverlay;
+        mPerfOverlay = nullptr;
+    }
+
     mRenderer->Shutdown();
     delete mRenderer;
     mRenderer = nullptr;
 
-    SDL_DestroyWindow(mWindow);
+    if (mWindow) {
+        SDL_DestroyWindow(mWindow);
+    }
     SDL_Quit();
+
+    delete mFrameArena;
+    mFrameArena = nullptr;
+
+    // Empty since UnloadScene
+    delete mSceneArena;
+    mSceneArena = nullptr;
+
+    // Last: nothing above may still be waiting on a job
+    delete mJobs;
+    mJobs = nullptr;
 }
 
 void Game::PlayMusic(const std::string& musicName)
 {
-    if (mMusicHandle.IsValid())
-    {
-        mAudio->StopSound(mMusicHandle);
-    }
-
-    mMusicHandle = mAudio->PlaySound(musicName, true, SoundCategory::Music);
+    // Streamed; the previous track fades out into this one
+    mMusicHandle = mAudio->PlayMusic(musicName, MUSIC_FADE_TIME);
 }
 
 void Game::BuildLevelFromJSON(const std::string& fileName)
 {
+    PROFILE_SCOPE("Game::BuildLevelFromJSON");
+
     const unsigned int FLIPPED_HORIZONTALLY_FLAG = 0x80000000;
     const unsigned int FLIPPED_VERTICALLY_FLAG   = 0x40000000;
     const unsigned int FLIPPED_DIAGONALLY_FLAG   = 0x20000000;
@@ -989,18 +1576,29 @@ void Game::BuildLevelFromJSON(const std::string& fileName)
     std::string tilesetName = "../Assets/Sprites/Blocks/Assets.png";
     Texture* tilesetTexture = mRenderer->GetTexture(tilesetName);
 
-    mLevelData = new int*[height];
+    // Um bloco contíguo na scene arena, linha após linha; UnloadScene não libera linha por linha
+    mLevelData = static_cast<int**>(mSceneArena->Allocate(height * sizeof(int*), alignof(int*)));
+    int* cells = static_cast<int*>(mSceneArena->Allocate(static_cast<size_t>(width) * height * sizeof(int), alignof(int)));
     for (int i = 0; i < height; ++i) {
-        mLevelData[i] = new int[width];
+        mLevelData[i] = cells + static_cast<size_t>(i) * width;
         for (int k = 0; k < width; k++) mLevelData[i][k] = -1;
     }
 
+    // Colisão com o terreno é resolvida direto neste grid, sem um collider por tile
+    mTileMap = new TileMapCollider(this, mLevelData, width, height, tileWidth);
+
     auto& layers = mapData["layers"];
     auto& tilesets = mapData["tilesets"];
 
     // -------------------------------------------------------
     // PASSO 1: PROCESSAR O CHÃO (TILE LAYERS)
     // -------------------------------------------------------
+    // Todas as camadas são desenhadas por um único componente, na mesma
+    // posição da lista de drawables que os blocos ocupavam
+    auto* terrain = new Actor(this);
+    mTileLayers = new TileLayerRenderer(terrain, 100);
+    int layerIndex = 0;
+
     for (const auto& layer : layers) {
         if (layer["type"] == "tilelayer" && layer["name"] != "Background") {
             std::string layerName = layer["name"];
@@ -1072,10 +1670,6 @@ void Game::BuildLevelFromJSON(const std::string& fileName)
 
                         Vector2 pos(j * mapTileWidth + mapTileWidth / 2.0f, i * mapTileHeight + mapTileHeight / 2.0f);
 
-                        Block* block = new Block(this, tex, srcX, srcY, mapTileWidth, isCollidable);
-                        block->SetPosition(pos);
-                        block->SetTexturePath(finalPathString);
-
                         // 3. CALCULAR ROTAÇÃO E FLIP BASEADO NO TILED
                         float rotation = 0.0f;
                         Vector2 scale(1.0f, 1.0f);
@@ -1109,13 +1703,18 @@ void Game::BuildLevelFromJSON(const std::string& fileName)
                             if (flipV) scale.y = -1.0f;
                         }
 
-                        // Aplica no bloco
-                        block->SetFlipData(rotation, scale);
+                        // Apenas visual: a colisão vem do mTileMap
+                        mTileLayers->AddTile(layerIndex, tex, srcX, srcY, mapTileWidth, pos, rotation, scale);
                     }
                 }
             }
+
+            layerIndex++;
         }
     }
+
+    // Assa os tiles em chunks estáticos (um VBO por textura em cada chunk)
+    mTileLayers->Build();
     
 
     for (const auto& layer : layers)
@@ -1222,24 +1821,20 @@ void Game::SetGameOverInfo(Actor* killer)
              return;
         }
 
-        // Fallback: Try to find a block underneath
-        Vector2 killerPos = killer->GetPosition();
-        for (auto* drawable : mDrawables) {
-            auto* b = dynamic_cast<Block*>(drawable->GetOwner());
-            if (b) {
-                 // Check distance (assuming 32x32 blocks)
-                 Vector2 diff = b->GetPosition() - killerPos;
-                 if (diff.LengthSq() < 1600.0f) { // 40x40 distance squared
-                     mGameOverInfo.isBlock = true;
-                     mGameOverInfo.killerName = "Trap";
-                     mGameOverInfo.killerSpritePath = b->GetTexturePath();
-                     mGameOverInfo.useSrcRect = true;
-                     mGameOverInfo.srcX = b->GetOriginalSrcX();
-                     mGameOverInfo.srcY = b->GetOriginalSrcY();
-                     mGameOverInfo.srcW = b->GetSize();
-                     mGameOverInfo.srcH = b->GetSize();
-                     return;
-                 }
+        // Fallback: Try to find a tile underneath
+        if (mTileLayers) {
+            // 40px radius, like the old 32x32 block search
+            const auto* tile = mTileLayers->FindTileNear(killer->GetPosition(), 40.0f);
+            if (tile) {
+                 mGameOverInfo.isBlock = true;
+                 mGameOverInfo.killerName = "Trap";
+                 mGameOverInfo.killerSpritePath = tile->texture->GetFileName();
+                 mGameOverInfo.useSrcRect = true;
+                 mGameOverInfo.srcX = tile->srcX;
+                 mGameOverInfo.srcY = tile->srcY;
+                 mGameOverInfo.srcW = tile->size;
+                 mGameOverInfo.srcH = tile->size;
+                 return;
             }
         }
     }
@@ -1284,21 +1879,11 @@ void Game::SetGameOverInfo(Actor* killer)
 
 void Game::SetLevelComplete(Actor* endActor)
 {
-    // Pause all active actors except the end sequence actor
-    for (auto actor : mActors)
-    {
+    // Pause all active actors except the end sequence actor (just spawned ones included)
+    mActors.ForEach([endActor](Actor* actor) {
         if (actor != endActor && actor->GetState() == ActorState::Active)
         {
             actor->SetState(ActorState::Paused);
         }
-    }
-
-    // Also handle pending actors
-    for (auto actor : mPendingActors)
-    {
-        if (actor != endActor && actor->GetState() == ActorState::Active)
-        {
-            actor->SetState(ActorState::Paused);
-        }
-    }
+    });
 }
@@ -8,10 +8,15 @@
 
 #pragma once
 #include <SDL.h>
+#include <cstdint>
+#include <string>
 #include <vector>
 #include "AudioSystem.h"
 #include "Renderer/Renderer.h"
 #include "UI/Screens/UIScreen.h"
+#include "Actors/ActorRegistry.h"
+#include "Actors/ActorCommands.h"
+#include "Components/ComponentSystem.h"
 #include <SDL_mixer.h>
 #include "./Json.h"
 
@@ -51,7 +56,8 @@ struct FloatingText {
     float duration;
     float timer;
     class Texture* texture;
-    class Actor* owner = nullptr;
+    // Text follows this actor while it is alive
+    ActorHandle owner;
 };
 
 class Spaceman;
@@ -66,11 +72,74 @@ public:
     void Shutdown();
     void Quit() { mIsRunning = false; }
 
+    // Headless: no window, GL context or audio device (null renderer and
+    // audio are swapped in). Must be set before Initialize.
+    void SetHeadless(bool headless) { mIsHeadless = headless; }
+    bool IsHeadless() const { return mIsHeadless; }
+    // Loads the scene and runs that many ticks back to back, uncapped
+    void RunHeadless(GameScene scene, int ticks);
+
+    // "Level2" -> GameScene::Level2; false if the name is unknown
+    static bool SceneFromName(const std::string& name, GameScene& outScene);
+
+    // Input recording and replay (see InputReplay.h). Set before Initialize.
+    // A replay reuses the recorded seed, tick rate and window size, and logs
+    // a state hash per tick to hashFileName (stdout when empty).
+    void SetRecordFile(const std::string& fileName);
+    bool SetReplayFile(const std::string& fileName, const std::string& hashFileName = "");
+    bool IsReplaying() const { return mReplay != nullptr; }
+    // Plays the replay back to back, uncapped, until it ends or maxTicks ran
+    void RunReplay(int maxTicks);
+
+    // Input of the current tick, live or replayed. Gameplay code reads these
+    // instead of asking SDL, so a replay sees exactly what the recording saw
+    const Uint8* GetKeyState() const { return mKeyState; }
+    Uint32 GetMouseState(int* x, int* y) const;
+    uint64_t GetTickIndex() const { return mTickIndex; }
+
+    // Profiler: F9 (or quitting, once a file was given here) dumps the
+    // last TRACE_SECONDS of zones as Chrome trace JSON
+    void SetTraceFile(const std::string& fileName);
+
+    // Fixed timestep: simulation ticks per second and how many ticks a slow
+    // frame may run to catch up (time beyond that is dropped)
+    void SetTickRate(float ticksPerSecond);
+    float GetTickRate() const { return mTickRate; }
+    void SetMaxCatchUpSteps(int steps) { mMaxCatchUpSteps = steps < 1 ? 1 : steps; }
+    // Where the frame being drawn sits between the last two ticks (0..1)
+    float GetRenderAlpha() const { return mRenderAlpha; }
+
+    // System update mode: every rigid body, then every collider, then every
+    // animator, then each actor's other components and OnUpdate. Off, each
+    // actor runs all its components then OnUpdate before the next actor.
+    // Set before Initialize so a recording carries it (a replay uses the recorded mode)
+    void SetSystemUpdate(bool enable) { mSystemUpdate = enable; }
+    bool IsSystemUpdate() const { return mSystemUpdate; }
+
+    // Job worker threads besides the main one (-1: one per spare core).
+    // Set before Initialize
+    void SetWorkerCount(int count) { mWorkerCount = count; }
+    // Usable from the main thread anywhere after Initialize, loading included
+    class JobSystem* GetJobs() { return mJobs; }
+    // Scratch memory for the current frame, reset when the next one starts.
+    // Main thread only
+    class FrameArena* GetFrameArena() { return mFrameArena; }
+    // Memory of the current scene's actors and components, freed at once on unload
+    class SceneArena* GetSceneArena() { return mSceneArena; }
+
     // Actor functions
     //void InitializeActors();
     void UpdateActors(float deltaTime);
-    void AddActor(class Actor* actor);
+    ActorHandle AddActor(class Actor* actor);
     void RemoveActor(class Actor* actor);
+    // Null once the actor was deleted
+    class Actor* GetActor(ActorHandle handle) const { return mActors.Get(handle); }
+    // Called once when an actor is marked Destroy; it is deleted after the next update
+    void AddDeadActor(class Actor* actor);
+    // Called once when an actor gets components; its table is rebuilt by FlushComponentTables
+    void AddDirtyComponentTable(class Actor* actor);
+    // Main thread, before any phase that looks components up from job threads
+    void FlushComponentTables();
 
     // UI functions
     void PushUI(class UIScreen* screen) { mUIStack.emplace_back(screen); }
@@ -103,15 +172,27 @@ public:
     static const int SPAWN_DISTANCE = 700;
     static const int FPS = 60;
 
+    size_t GetActorCount() const { return mActors.GetCount(); }
+
     // Draw functions
     void AddDrawable(class DrawComponent* drawable);
     void RemoveDrawable(class DrawComponent* drawable);
-    std::vector<class DrawComponent*>& GetDrawables() { return mDrawables; }
+    class DrawableRegistry& GetDrawables() { return *mDrawables; }
 
     // Collider functions
     void AddCollider(class AABBColliderComponent* collider);
     void RemoveCollider(class AABBColliderComponent* collider);
-    std::vector<class AABBColliderComponent*>& GetColliders() { return mColliders; }
+    ComponentSystem<class AABBColliderComponent>& GetColliders() { return mColliders; }
+    class SpatialHashGrid* GetCollisionGrid() { return mCollisionGrid; }
+    class TileMapCollider* GetTileMap() { return mTileMap; }
+
+    // Physics and animation systems
+    void AddRigidBody(class RigidBodyComponent* body);
+    void RemoveRigidBody(class RigidBodyComponent* body);
+    void AddAnimator(class AnimatorComponent* animator);
+    void RemoveAnimator(class AnimatorComponent* animator);
+
+    class ParticleEngine* GetParticleEngine() { return mParticleEngine; }
 
     // Camera functions
     Vector2& GetCameraPos() { return mCameraPos; };
@@ -121,6 +202,10 @@ public:
     void AddParallaxActor(class ParallaxActor* actor);
     void RemoveParallaxActor(class ParallaxActor* actor);
 
+    // Actor pools in use (see ActorPool); they register on first use
+    void AddActorPool(class ActorPoolBase* pool) { mActorPools.emplace_back(pool); }
+    const std::vector<class ActorPoolBase*>& GetActorPools() const { return mActorPools; }
+
     // Game specific
     const class Spaceman* GetPlayer() const { return mPlayer; }
     class Spaceman* GetPlayer() { return mPlayer; }
@@ -146,10 +231,29 @@ public:
 
 private:
     void ProcessInput();
+    void HandleEvent(const SDL_Event& event);
+    void ProcessActorInput();
     void UpdateGame(float deltaTime);
     void UpdateCamera();
     void GenerateOutput();
 
+    // Snapshots actor and camera transforms at the start of a tick
+    void SaveRenderState();
+
+    void UpdateSystems(float deltaTime);
+    // Parallel AI: OnThink of every thinking actor over the job threads, then
+    // their commands on this thread
+    void ThinkActors(float deltaTime);
+    // Rigid body integration and tile passes worked out on the job threads
+    // ahead of the update, which replays them (see RigidBodyComponent::Prepare)
+    void PreparePhysics(float deltaTime);
+
+    // One simulation step: gathers the tick's input (live, recorded or
+    // replayed), then updates
+    void RunTick(float deltaTime);
+    void RunUncapped(int ticks);
+    uint64_t ComputeStateHash() const;
+
     void UpdateUI(float deltaTime);
 
     // Level loading
@@ -157,9 +261,12 @@ private:
     void BuildLevel(int** levelData, int width, int height);
 
     // All the actors in the game
-    std::vector<class Actor*> mActors;
-    std::vector<class Actor*> mPendingActors;
+    ActorRegistry mActors;
+    std::vector<ActorHandle> mDeadActors;
+    std::vector<ActorHandle> mDirtyComponentTables;
     std::vector<class ParallaxActor*> mParallaxActors;
+    // Not owned: each lives next to its actor type
+    std::vector<class ActorPoolBase*> mActorPools;
 
     // Camera
     Vector2 mCameraPos;
@@ -174,26 +281,78 @@ private:
     // HUD
     class HUD* mHUD;
 
+    // F3 frame time / counters overlay
+    class PerfOverlay* mPerfOverlay;
+    bool mShowPerfOverlay;
+    float mLastPresentMs;
+
     // All UI screens in the game
     std::vector<class UIScreen*> mUIStack;
 
     // All the draw components
-    std::vector<class DrawComponent*> mDrawables;
+    class DrawableRegistry* mDrawables;
 
     // All the collision components
-    std::vector<class AABBColliderComponent*> mColliders;
+    ComponentSystem<class AABBColliderComponent> mColliders;
+
+    // Swept one type at a time in system update mode
+    ComponentSystem<class RigidBodyComponent> mRigidBodies;
+    ComponentSystem<class AnimatorComponent> mAnimators;
+    bool mSystemUpdate;
+
+    // Worker threads for parallel jobs
+    class JobSystem* mJobs;
+    int mWorkerCount;
+    class FrameArena* mFrameArena;
+    class SceneArena* mSceneArena;
+    // UnloadScene is deleting the whole scene: Game's lists are cleared
+    // afterwards, so leaving them one component at a time is skipped
+    bool mIsUnloading;
+    // One per job thread, filled by ThinkActors
+    std::vector<ActorCommands> mThinkCommands;
+
+    // Broadphase used by the collision queries
+    class SpatialHashGrid* mCollisionGrid;
+
+    // Every particle of the scene
+    class ParticleEngine* mParticleEngine;
 
     // SDL stuff
     SDL_Window* mWindow;
     class Renderer* mRenderer;
 
-    // Track elapsed time since game start
-    Uint32 mTicksCount;
+    // Fixed timestep clock
+    Uint64 mLastCounter;
+    double mAccumulator;
+    float mTickRate;
+    int mMaxCatchUpSteps;
+    float mRenderAlpha;
+
+    // Camera at the start of the tick, for render interpolation
+    Vector2 mPrevCameraPos;
+    bool mHasPrevCamera;
+
+    // Input of the current tick
+    const Uint8* mKeyState;
+    int mMouseX;
+    int mMouseY;
+    Uint32 mMouseButtons;
+    uint64_t mTickIndex;
+
+    // Input recording / replay
+    std::string mRecordFile;
+    class InputRecorder* mRecorder;
+    class InputReplay* mReplay;
+
+    // Profiler trace
+    std::string mTraceFile;
+    bool mDumpTraceOnExit;
+    const float TRACE_SECONDS = 10.0f;
 
     // Track if we're updating actors right now
     bool mIsRunning;
+    bool mIsHeadless;
     bool mIsDebugging;
-    bool mUpdatingActors;
 
     // Game-specific
     GameScene mCurrentScene;
@@ -201,6 +360,8 @@ private:
     GameState mState;
     class Spaceman *mPlayer;
     int **mLevelData;
+    class TileMapCollider* mTileMap;
+    class TileLayerRenderer* mTileLayers;
     bool mIsPlayerDead;
     int mCoinCount;
 
@@ -227,4 +388,6 @@ private:
     FadeState mFadeState;
     float mFadeTimer;
     const float FADE_TIME = 0.25f;
+    // Each half of a music crossfade (out, then in)
+    const float MUSIC_FADE_TIME = 0.5f;
 };
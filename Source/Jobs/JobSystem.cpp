@@ -0,0 +1,268 @@
+#include "JobSystem.h"
+#include <string>
+#include "../Profiler.h"
+
+namespace
+{
+    // Which system and queue the running thread belongs to
+    thread_local JobSystem* tOwner = nullptr;
+    thread_local int tThreadIndex = -1;
+}
+
+JobSystem::JobSystem(int numWorkers)
+    : mQueuedJobs(0)
+    , mSleepingWorkers(0)
+    , mQuit(false)
+    , mLastUtilizationTime(Clock::now())
+    , mLastBusyNs(0)
+{
+    numWorkers = std::max(numWorkers, 0);
+    for (int i = 0; i <= numWorkers; i++)
+    {
+        mQueues.emplace_back(std::make_unique<Queue>());
+    }
+
+    tOwner = this;
+    tThreadIndex = 0;
+
+    for (int i = 1; i <= numWorkers; i++)
+    {
+        mThreads.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mQuit.store(true);
+    }
+    mWakeUp.notify_all();
+
+    for (std::thread& thread : mThreads)
+    {
+        thread.join();
+    }
+
+    if (tOwner == this)
+    {
+        tOwner = nullptr;
+        tThreadIndex = -1;
+    }
+}
+
+int JobSystem::GetDefaultWorkerCount()
+{
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 1 ? static_cast<int>(cores) - 1 : 0;
+}
+
+int JobSystem::GetThreadIndex() const
+{
+    return tOwner == this ? tThreadIndex : -1;
+}
+
+size_t JobSystem::GetBatchSize(size_t count, size_t minBatch) const
+{
+    size_t numBatches = (mThreads.size() + 1) * 4;
+    size_t batch = (count + numBatches - 1) / numBatches;
+    return std::max(std::max(batch, minBatch), static_cast<size_t>(1));
+}
+
+void JobSystem::Schedule(const char* name, std::function<void()> func, JobCounter* counter, JobCounter* after)
+{
+    Job job;
+    job.func = std::move(func);
+    job.name = name;
+    job.counter = counter;
+
+    if (counter)
+    {
+        counter->mValue.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (after)
+    {
+        std::lock_guard<std::mutex> lock(after->mMutex);
+        if (after->mValue.load(std::memory_order_acquire) != 0)
+        {
+            // Finish pushes it when `after` drops to zero
+            after->mContinuations.emplace_back(std::move(job));
+            return;
+        }
+    }
+
+    Push(std::move(job));
+}
+
+void JobSystem::Push(Job job)
+{
+    // Threads outside the system feed the main thread's queue (workers steal from it)
+    int index = std::max(GetThreadIndex(), 0);
+
+    // Counted before it is visible, so the count never runs behind the queues.
+    // A worker going to sleep bumps mSleepingWorkers before checking
+    // mQueuedJobs, so one of the two sides always sees the other
+    mQueuedJobs.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(mQueues[index]->mutex);
+        mQueues[index]->jobs.emplace_back(std::move(job));
+    }
+
+    if (mSleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mWakeUp.notify_one();
+    }
+}
+
+bool JobSystem::FindJob(Job& outJob)
+{
+    if (mQueuedJobs.load(std::memory_order_relaxed) <= 0)
+    {
+        return false;
+    }
+
+    int self = GetThreadIndex();
+    int numQueues = static_cast<int>(mQueues.size());
+
+    // Newest job of our own queue: its data is most likely still in cache
+    if (self >= 0)
+    {
+        Queue& queue = *mQueues[self];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            outJob = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            mQueuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Oldest job of someone else's, which tends to be the biggest piece left
+    int start = std::max(self, 0);
+    for (int i = 1; i <= numQueues; i++)
+    {
+        Queue& queue = *mQueues[(start + i) % numQueues];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            outJob = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            mQueuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::Execute(Job& job)
+{
+    Clock::time_point start = Clock::now();
+    {
+#ifdef ENABLE_PROFILER
+        Profiler::Zone zone(job.name);
+#endif
+        if (job.rangeFunc)
+        {
+            job.rangeFunc(job.rangeData, job.begin, job.end);
+        }
+        else
+        {
+            job.func();
+        }
+    }
+
+    int index = GetThreadIndex();
+    if (index >= 0)
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        mQueues[index]->busyNs.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+    }
+
+    if (job.counter)
+    {
+        Finish(*job.counter);
+    }
+}
+
+void JobSystem::Finish(JobCounter& counter)
+{
+    std::vector<Job> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter.mMutex);
+        if (counter.mValue.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            continuations.swap(counter.mContinuations);
+        }
+    }
+
+    // Not touching counter anymore: a waiter may already be destroying it
+    for (Job& job : continuations)
+    {
+        Push(std::move(job));
+    }
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        Job job;
+        if (FindJob(job))
+        {
+            Execute(job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // The job that brought it to zero may still be inside Finish
+    std::lock_guard<std::mutex> lock(counter.mMutex);
+}
+
+void JobSystem::WorkerLoop(int index)
+{
+    tOwner = this;
+    tThreadIndex = index;
+    Profiler::SetThreadName("Job worker " + std::to_string(index));
+
+    while (!mQuit.load())
+    {
+        Job job;
+        if (FindJob(job))
+        {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mSleepingWorkers.fetch_add(1);
+        mWakeUp.wait(lock, [this]() { return mQuit.load() || mQueuedJobs.load() > 0; });
+        mSleepingWorkers.fetch_sub(1);
+    }
+}
+
+float JobSystem::TakeUtilization()
+{
+    Clock::time_point now = Clock::now();
+
+    uint64_t busyNs = 0;
+    for (size_t i = 1; i < mQueues.size(); i++)
+    {
+        busyNs += mQueues[i]->busyNs.load(std::memory_order_relaxed);
+    }
+
+    double available = std::chrono::duration<double, std::nano>(now - mLastUtilizationTime).count() * mThreads.size();
+    float utilization = available > 0.0 ? static_cast<float>((busyNs - mLastBusyNs) / available) : 0.0f;
+
+    mLastUtilizationTime = now;
+    mLastBusyNs = busyNs;
+
+    // Jobs are credited when they end, so one spanning two samples can overshoot
+    return std::min(utilization, 1.0f);
+}
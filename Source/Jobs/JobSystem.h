@@ -0,0 +1,169 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class JobCounter;
+
+// A unit of work: either a plain function or one batch of a ParallelFor
+struct Job
+{
+    std::function<void()> func;
+
+    void (*rangeFunc)(void* data, size_t begin, size_t end) = nullptr;
+    void* rangeData = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+
+    // Zone name in the profiler trace (a string literal)
+    const char* name = "Job";
+    // Dropped by one when the job finishes
+    JobCounter* counter = nullptr;
+};
+
+// Number of unfinished jobs scheduled with it. Wait on it, or schedule jobs
+// to start only once it reaches zero. Must outlive those jobs (wait for it
+// before it goes out of scope); it can be reused once it is done.
+class JobCounter
+{
+public:
+    JobCounter() : mValue(0) {}
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return mValue.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int> mValue;
+    // Guards the drop to zero against jobs being added to mContinuations
+    std::mutex mMutex;
+    std::vector<Job> mContinuations;
+};
+
+// Worker threads (one per extra core) pulling jobs from per-thread deques:
+// a thread pops its own newest job and, when empty, steals the oldest job of
+// another thread. The thread that creates the system (the main thread) owns
+// deque 0 and runs jobs only while it waits. Any thread may schedule and
+// wait; waiting runs other jobs instead of blocking, so jobs may wait too.
+class JobSystem
+{
+public:
+    // numWorkers threads besides the creating one; with 0 every job runs on
+    // the thread that waits for it
+    explicit JobSystem(int numWorkers);
+    // Joins the workers; every scheduled job must have been waited for
+    ~JobSystem();
+
+    // One worker per core the main thread doesn't use
+    static int GetDefaultWorkerCount();
+
+    int GetWorkerCount() const { return static_cast<int>(mThreads.size()); }
+
+    // 0 on the creating thread, 1..GetWorkerCount() on the workers, -1 on
+    // any other thread. Handy to pick a per-thread buffer inside a job
+    int GetThreadIndex() const;
+
+    // Queues func on the calling thread's deque. counter, if given, counts it
+    // until it finishes; if `after` is given, func only starts once `after`
+    // reaches zero
+    void Schedule(const char* name, std::function<void()> func, JobCounter* counter = nullptr, JobCounter* after = nullptr);
+
+    // Runs jobs until counter reaches zero
+    void Wait(JobCounter& counter);
+
+    // func(begin, end) over [0, count) in batches of at least minBatch items,
+    // spread over every thread (the caller included). Returns once all ran
+    template <typename Func>
+    void ParallelFor(const char* name, size_t count, size_t minBatch, Func&& func)
+    {
+        size_t batch = GetBatchSize(count, minBatch);
+        if (batch >= count)
+        {
+            if (count > 0)
+            {
+                func(static_cast<size_t>(0), count);
+            }
+            return;
+        }
+
+        using FuncType = typename std::remove_reference<Func>::type;
+        auto call = [](void* data, size_t begin, size_t end) {
+            (*static_cast<FuncType*>(data))(begin, end);
+        };
+
+        // The caller keeps the first batch for itself
+        JobCounter counter;
+        // Batches after the first
+        counter.mValue.store(static_cast<int>((count - 1) / batch));
+        for (size_t begin = batch; begin < count; begin += batch)
+        {
+            Job job;
+            job.rangeFunc = call;
+            job.rangeData = const_cast<void*>(static_cast<const void*>(&func));
+            job.begin = begin;
+            job.end = std::min(begin + batch, count);
+            job.name = name;
+            job.counter = &counter;
+            Push(std::move(job));
+        }
+
+        Job first;
+        first.rangeFunc = call;
+        first.rangeData = const_cast<void*>(static_cast<const void*>(&func));
+        first.end = batch;
+        first.name = name;
+        Execute(first);
+
+        Wait(counter);
+    }
+
+    // Share of the workers' time spent running jobs since the last call, 0..1.
+    // Call it from one thread only (the perf overlay does, once per frame)
+    float TakeUtilization();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+        // Nanoseconds spent in jobs by the thread that owns this queue
+        std::atomic<uint64_t> busyNs{0};
+    };
+
+    // Aim for a few batches per thread so stealing can even out uneven ones
+    size_t GetBatchSize(size_t count, size_t minBatch) const;
+
+    void Push(Job job);
+    bool FindJob(Job& outJob);
+    void Execute(Job& job);
+    void Finish(JobCounter& counter);
+    void WorkerLoop(int index);
+
+    // Queue 0 belongs to the creating thread, queue i to worker i
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    std::vector<std::thread> mThreads;
+
+    // Queued jobs not taken yet, so idle workers know when to wake up
+    std::atomic<int> mQueuedJobs;
+    std::atomic<int> mSleepingWorkers;
+    std::mutex mSleepMutex;
+    std::condition_variable mWakeUp;
+    std::atomic<bool> mQuit;
+
+    Clock::time_point mLastUtilizationTime;
+    uint64_t mLastBusyNs;
+};
@@ -7,15 +7,106 @@
 //
 
 #include "Game.h"
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
 
 int main(int argc, char** argv)
 {
+    // --headless [--scene Level2] [--ticks 10000]
+    // --record run.rep | --replay run.rep [--hashes hashes.txt]
+    // --trace trace.json (profiler builds only)
+    // --system-update (update components one type at a time, see Game::SetSystemUpdate)
+    // --workers 4 (job threads besides the main one; default one per spare core)
+    bool headless = false;
+    bool systemUpdate = false;
+    int workers = -1;
+    GameScene scene = GameScene::Level1;
+    int ticks = -1;
+    std::string recordFile;
+    std::string replayFile;
+    std::string hashFile;
+    std::string traceFile;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            headless = true;
+        }
+        else if (std::strcmp(argv[i], "--scene") == 0 && i + 1 < argc)
+        {
+            if (!Game::SceneFromName(argv[++i], scene))
+            {
+                SDL_Log("Unknown scene: %s", argv[i]);
+                return 1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+        {
+            ticks = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            recordFile = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            replayFile = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--hashes") == 0 && i + 1 < argc)
+        {
+            hashFile = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            traceFile = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--system-update") == 0)
+        {
+            systemUpdate = true;
+        }
+        else if (std::strcmp(argv[i], "--workers") == 0 && i + 1 < argc)
+        {
+            workers = std::atoi(argv[++i]);
+        }
+    }
+
     Game game;
+    game.SetHeadless(headless);
+    game.SetSystemUpdate(systemUpdate);
+    game.SetWorkerCount(workers);
+    if (!recordFile.empty())
+    {
+        game.SetRecordFile(recordFile);
+    }
+    if (!traceFile.empty())
+    {
+        game.SetTraceFile(traceFile);
+    }
+    if (!replayFile.empty() && !game.SetReplayFile(replayFile, hashFile))
+    {
+        return 1;
+    }
+
     bool success = game.Initialize();
     if (success)
     {
-        game.RunLoop();
+        if (headless && game.IsReplaying())
+        {
+            // Until the recording ends
+            game.RunReplay(ticks < 0 ? std::numeric_limits<int>::max() : ticks);
+        }
+        else if (headless)
+        {
+            game.RunHeadless(scene, ticks < 0 ? 600 : ticks);
+        }
+        else
+        {
+            game.RunLoop();
+        }
     }
     game.Shutdown();
-    return 0;
+    return success ? 0 : 1;
 }
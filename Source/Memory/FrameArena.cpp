@@ -0,0 +1,70 @@
+#include "FrameArena.h"
+#include <cstdint>
+
+namespace
+{
+    size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+FrameArena::FrameArena(size_t capacity)
+    : mBlock(new char[capacity])
+    , mCapacity(capacity)
+    , mUsed(0)
+    , mOverflowBytes(0)
+    , mLastFrameBytes(0)
+{
+}
+
+FrameArena::~FrameArena()
+{
+    for (char* block : mOverflow)
+    {
+        delete[] block;
+    }
+    delete[] mBlock;
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment)
+{
+    // Alignment relative to the real address: new char[] only promises max_align_t
+    uintptr_t base = reinterpret_cast<uintptr_t>(mBlock);
+    size_t offset = AlignUp(base + mUsed, alignment) - base;
+    if (offset + size <= mCapacity)
+    {
+        mUsed = offset + size;
+        return mBlock + offset;
+    }
+
+    // Doesn't fit: its own heap block until the next Reset
+    char* block = new char[size + alignment];
+    mOverflow.emplace_back(block);
+    mOverflowBytes += size + alignment;
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(block);
+    return block + (AlignUp(address, alignment) - address);
+}
+
+void FrameArena::Reset()
+{
+    mLastFrameBytes = mUsed + mOverflowBytes;
+
+    if (!mOverflow.empty())
+    {
+        for (char* block : mOverflow)
+        {
+            delete[] block;
+        }
+        mOverflow.clear();
+
+        // With some slack, since alignment padding varies between frames
+        mCapacity = mLastFrameBytes + mLastFrameBytes / 2;
+        delete[] mBlock;
+        mBlock = new char[mCapacity];
+    }
+
+    mUsed = 0;
+    mOverflowBytes = 0;
+}
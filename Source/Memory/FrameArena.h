@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+template <typename T>
+class FrameAllocator;
+
+// Bump allocator for data that lives for a single frame: allocating is a
+// pointer increment and everything is freed at once by Reset, at the start
+// of the next frame. Main thread only.
+class FrameArena
+{
+public:
+    explicit FrameArena(size_t capacity);
+    ~FrameArena();
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Frees the whole frame. If it didn't fit, the block grows to what the
+    // frame needed, so the same load doesn't touch the heap again
+    void Reset();
+
+    // Vector whose storage comes from this arena (see FrameVector)
+    template <typename T>
+    std::vector<T, FrameAllocator<T>> MakeVector(size_t reserve = 0);
+
+    size_t GetCapacity() const { return mCapacity; }
+    // Bytes handed out last frame, overflow included
+    size_t GetLastFrameBytes() const { return mLastFrameBytes; }
+
+private:
+    char* mBlock;
+    size_t mCapacity;
+    size_t mUsed;
+
+    // Allocations that didn't fit in mBlock, freed on Reset
+    std::vector<char*> mOverflow;
+    size_t mOverflowBytes;
+
+    size_t mLastFrameBytes;
+};
+
+// STL allocator over a FrameArena. deallocate does nothing: the memory goes
+// back when the arena is reset, so a container using it must not outlive
+// the frame
+template <typename T>
+class FrameAllocator
+{
+public:
+    using value_type = T;
+
+    explicit FrameAllocator(FrameArena* arena) : mArena(arena) {}
+
+    template <typename U>
+    FrameAllocator(const FrameAllocator<U>& other) : mArena(other.GetArena()) {}
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(mArena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {}
+
+    FrameArena* GetArena() const { return mArena; }
+
+private:
+    FrameArena* mArena;
+};
+
+template <typename T, typename U>
+bool operator==(const FrameAllocator<T>& a, const FrameAllocator<U>& b)
+{
+    return a.GetArena() == b.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const FrameAllocator<T>& a, const FrameAllocator<U>& b)
+{
+    return a.GetArena() != b.GetArena();
+}
+
+// Scratch vector for a single frame
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+template <typename T>
+FrameVector<T> FrameArena::MakeVector(size_t reserve)
+{
+    FrameVector<T> vector{FrameAllocator<T>(this)};
+    vector.reserve(reserve);
+    return vector;
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <cstddef>
+
+// Counts global heap allocations: HeapStats.cpp replaces operator new for
+// the whole program (game and bench). Steady gameplay should show zero per
+// frame on the F3 overlay.
+namespace HeapStats
+{
+    // operator new calls so far, from every thread
+    size_t GetAllocationCount();
+}
@@ -0,0 +1,137 @@
+#include "SceneArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace
+{
+    size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    // In front of every AllocateObject object: the arena it came from, or
+    // null for the heap. Padded so the object keeps max_align_t alignment
+    struct alignas(std::max_align_t) ObjectHeader
+    {
+        SceneArena* arena;
+    };
+}
+
+SceneArena* SceneArena::sActive = nullptr;
+
+SceneArena::SceneArena(size_t blockSize)
+    : mBlockSize(blockSize)
+    , mCapacity(0)
+    , mLastBlockSize(0)
+    , mUsed(0)
+    , mFullBytes(0)
+    , mObjects(0)
+{
+    AddBlock(blockSize);
+}
+
+SceneArena::~SceneArena()
+{
+    for (char* block : mBlocks)
+    {
+        delete[] block;
+    }
+}
+
+void SceneArena::AddBlock(size_t size)
+{
+    mBlocks.emplace_back(new char[size]);
+    mCapacity += size;
+    mLastBlockSize = size;
+    mFullBytes += mUsed;
+    mUsed = 0;
+}
+
+void* SceneArena::Allocate(size_t size, size_t alignment)
+{
+    // Alignment relative to the real address: new char[] only promises max_align_t
+    uintptr_t base = reinterpret_cast<uintptr_t>(mBlocks.back());
+    size_t offset = AlignUp(base + mUsed, alignment) - base;
+    if (offset + size > mLastBlockSize)
+    {
+        // Blocks never move, objects already handed out stay where they are
+        AddBlock(std::max(mBlockSize, size + alignment));
+        base = reinterpret_cast<uintptr_t>(mBlocks.back());
+        offset = AlignUp(base, alignment) - base;
+    }
+
+    mUsed = offset + size;
+    return mBlocks.back() + offset;
+}
+
+size_t SceneArena::GetUsedBytes() const
+{
+    return mFullBytes + mUsed;
+}
+
+void SceneArena::Reset()
+{
+    if (mBlocks.size() > 1)
+    {
+        // With some slack, the next scene may be a bigger level
+        size_t size = GetUsedBytes() + GetUsedBytes() / 2;
+        for (char* block : mBlocks)
+        {
+            delete[] block;
+        }
+        mBlocks.clear();
+        mCapacity = 0;
+        mUsed = 0;
+        mFullBytes = 0;
+        AddBlock(size);
+    }
+
+    mUsed = 0;
+    mFullBytes = 0;
+}
+
+SceneArena::Scope::Scope(SceneArena* arena)
+    : mPrevious(sActive)
+{
+    sActive = arena;
+}
+
+SceneArena::Scope::~Scope()
+{
+    sActive = mPrevious;
+}
+
+void* SceneArena::AllocateObject(size_t size)
+{
+    void* memory;
+    if (sActive)
+    {
+        memory = sActive->Allocate(sizeof(ObjectHeader) + size, alignof(ObjectHeader));
+        sActive->mObjects++;
+    }
+    else
+    {
+        memory = ::operator new(sizeof(ObjectHeader) + size);
+    }
+
+    auto* header = new (memory) ObjectHeader{sActive};
+    return header + 1;
+}
+
+void SceneArena::FreeObject(void* p)
+{
+    if (!p)
+    {
+        return;
+    }
+
+    ObjectHeader* header = static_cast<ObjectHeader*>(p) - 1;
+    if (header->arena)
+    {
+        header->arena->mObjects--;
+        return;
+    }
+
+    ::operator delete(header);
+}
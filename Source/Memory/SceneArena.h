@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Memory for what lives exactly as long as a scene: the actors and
+// components built while loading it and the level grid. Allocating is a
+// pointer increment; nothing is given back one by one, the whole scene goes
+// at once in Reset (Game::UnloadScene). Main thread only.
+class SceneArena
+{
+public:
+    explicit SceneArena(size_t blockSize);
+    ~SceneArena();
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Frees the whole scene. Every object allocated through AllocateObject
+    // must have been destroyed already. If the scene needed more than one
+    // block, the next one gets a single block that size
+    void Reset();
+
+    size_t GetCapacity() const { return mCapacity; }
+    size_t GetUsedBytes() const;
+    // Objects allocated through AllocateObject and not deleted yet
+    int GetObjectCount() const { return mObjects; }
+
+    // While one is alive, AllocateObject takes memory from arena (null: the
+    // heap). Nests; Game opens one around building a scene
+    class Scope
+    {
+    public:
+        explicit Scope(SceneArena* arena);
+        ~Scope();
+
+    private:
+        SceneArena* mPrevious;
+    };
+
+    // Class-level operator new/delete of Actor and Component. FreeObject
+    // works on either kind of memory: arena objects are only counted, their
+    // memory comes back on Reset
+    static void* AllocateObject(size_t size);
+    static void FreeObject(void* p);
+
+private:
+    void AddBlock(size_t size);
+
+    std::vector<char*> mBlocks;
+    size_t mBlockSize;
+    size_t mCapacity;
+    // Of the last block, the one being filled
+    size_t mLastBlockSize;
+    size_t mUsed;
+    // Bytes in the blocks before the last one
+    size_t mFullBytes;
+    int mObjects;
+
+    static SceneArena* sActive;
+};
@@ -0,0 +1,27 @@
+#include "NullAudioSystem.h"
+#include "SDL_mixer.h"
+
+NullAudioSystem::NullAudioSystem()
+    : AudioSystem(NoDevice())
+{
+}
+
+SoundHandle NullAudioSystem::PlaySound(const std::string& /*soundName*/, bool /*looping*/, SoundCategory /*category*/)
+{
+    return SoundHandle::Invalid;
+}
+
+SoundHandle NullAudioSystem::PlayMusic(const std::string& /*musicName*/, float /*fadeSeconds*/)
+{
+    return SoundHandle::Invalid;
+}
+
+void NullAudioSystem::SetBusVolume(SoundCategory category, int volume)
+{
+    // Only remembered, so options screens still read back what they set
+    if (volume < 0) volume = 0;
+    if (volume > MIX_MAX_VOLUME) volume = MIX_MAX_VOLUME;
+
+    if (category == SoundCategory::Music) mMusicVolume = volume;
+    else mSFXVolume = volume;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "AudioSystem.h"
+
+// Audio backend for headless runs: never opens the SDL_mixer device and
+// plays nothing. Every sound comes back as an invalid (stopped) handle.
+class NullAudioSystem : public AudioSystem
+{
+public:
+    NullAudioSystem();
+
+    void Update(float /*deltaTime*/) override {}
+
+    SoundHandle PlaySound(const std::string& soundName, bool looping = false, SoundCategory category = SoundCategory::SFX) override;
+    SoundHandle PlayMusic(const std::string& musicName, float fadeSeconds = 0.0f) override;
+
+    void StopSound(SoundHandle /*sound*/) override {}
+    void PauseSound(SoundHandle /*sound*/) override {}
+    void ResumeSound(SoundHandle /*sound*/) override {}
+    void PauseAllSounds(SoundHandle /*exception*/ = SoundHandle::Invalid) override {}
+    void ResumeAllSounds(SoundHandle /*exception*/ = SoundHandle::Invalid) override {}
+    void StopAllSounds(SoundHandle /*exception*/ = SoundHandle::Invalid) override {}
+
+    void SetBusVolume(SoundCategory category, int volume) override;
+
+    SoundState GetSoundState(SoundHandle /*sound*/) override { return SoundState::Stopped; }
+
+    void CacheAllSounds() override {}
+    void CacheSound(const std::string& /*soundName*/) override {}
+};
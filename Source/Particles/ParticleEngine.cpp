@@ -0,0 +1,438 @@
+#include "ParticleEngine.h"
+#include "../Game.h"
+#include "../Actors/Actor.h"
+#include "../Components/Drawing/DrawComponent.h"
+#include "../Components/Physics/AABBColliderComponent.h"
+#include "../Physics/SpatialHashGrid.h"
+#include "../Physics/TileMapCollider.h"
+#include "../Renderer/Renderer.h"
+#include "../Renderer/SpriteSheetCache.h"
+#include <algorithm>
+#include <cmath>
+#include "../Profiler.h"
+
+namespace
+{
+    // Same limits and gravity RigidBodyComponent applies
+    const float MAX_SPEED_X = 700.0f;
+    const float MAX_SPEED_Y = 1400.0f;
+    const float GRAVITY = 1800.0f;
+
+    // Same rate AnimatorComponent used for the particle animations
+    const float ANIM_FPS = 10.0f;
+
+    class ParticleDrawComponent : public DrawComponent
+    {
+    public:
+        ParticleDrawComponent(Actor* owner, ParticleEngine* engine)
+            : DrawComponent(owner)
+            , mEngine(engine)
+        {
+        }
+
+        void Draw(Renderer* renderer) override
+        {
+            mEngine->Draw(renderer);
+        }
+
+    private:
+        ParticleEngine* mEngine;
+    };
+
+}
+
+ParticleEngine::ParticleEngine(Game* game)
+    : mGame(game)
+    , mNextPoolId(1)
+    , mDrawActor(nullptr)
+{
+}
+
+ParticleEngine::~ParticleEngine()
+{
+    Clear();
+}
+
+int ParticleEngine::CreatePool(const ParticlePoolDesc& desc)
+{
+    auto* pool = new ParticlePool();
+    pool->id = mNextPoolId++;
+    pool->desc = desc;
+    pool->isReleased = false;
+
+    size_t capacity = static_cast<size_t>(std::max(desc.capacity, 0));
+    pool->posX.resize(capacity, 0.0f);
+    pool->posY.resize(capacity, 0.0f);
+    pool->velX.resize(capacity, 0.0f);
+    pool->velY.resize(capacity, 0.0f);
+    pool->rotation.resize(capacity, 0.0f);
+    pool->lifetime.resize(capacity, 0.0f);
+    pool->animTimer.resize(capacity, 0.0f);
+    pool->state.resize(capacity, ParticleState::Dead);
+    pool->liveSlot.resize(capacity, -1);
+    pool->live.reserve(capacity);
+
+    // Popped from the back, so slot 0 is used first like the old pool scan
+    pool->freeList.reserve(capacity);
+    for (int i = static_cast<int>(capacity) - 1; i >= 0; i--)
+    {
+        pool->freeList.emplace_back(i);
+    }
+
+    mPools.emplace_back(pool);
+    EnsureDrawActor();
+
+    return pool->id;
+}
+
+void ParticleEngine::ReleasePool(int id)
+{
+    ParticlePool* pool = FindPool(id);
+    if (!pool)
+    {
+        return;
+    }
+
+    // The callback usually captures the owner, which is going away
+    pool->isReleased = true;
+    pool->onCollision = nullptr;
+}
+
+void ParticleEngine::SetCollisionCallback(int id, CollisionCallback callback)
+{
+    if (ParticlePool* pool = FindPool(id))
+    {
+        pool->onCollision = std::move(callback);
+    }
+}
+
+void ParticleEngine::Emit(int id, const Vector2& position, float rotation, const Vector2& velocity, float lifetime)
+{
+    ParticlePool* pool = FindPool(id);
+    if (!pool || pool->isReleased || pool->freeList.empty())
+    {
+        return;
+    }
+
+    int index = pool->freeList.back();
+    pool->freeList.pop_back();
+
+    pool->posX[index] = position.x;
+    pool->posY[index] = position.y;
+    pool->velX[index] = velocity.x;
+    pool->velY[index] = velocity.y;
+    pool->rotation[index] = rotation;
+    pool->lifetime[index] = lifetime;
+    pool->animTimer[index] = 0.0f;
+    pool->state[index] = ParticleState::Flying;
+
+    pool->liveSlot[index] = static_cast<int>(pool->live.size());
+    pool->live.emplace_back(index);
+}
+
+void ParticleEngine::Update(float deltaTime)
+{
+    PROFILE_SCOPE("ParticleEngine::Update");
+
+    // By index: collision callbacks may spawn actors that create pools
+    for (size_t i = 0; i < mPools.size(); i++)
+    {
+        UpdatePool(*mPools[i], deltaTime);
+    }
+
+    // Free released pools once their last particle is gone
+    auto iter = std::remove_if(mPools.begin(), mPools.end(), [](ParticlePool* pool) {
+        if (pool->isReleased && pool->live.empty())
+        {
+            delete pool;
+            return true;
+        }
+        return false;
+    });
+    mPools.erase(iter, mPools.end());
+}
+
+void ParticleEngine::UpdatePool(ParticlePool& pool, float deltaTime)
+{
+    const ParticlePoolDesc& desc = pool.desc;
+    const float explodeFrames = static_cast<float>(desc.explodeFrameCount);
+
+    // Backwards, so a kill only swaps in a particle that was already updated
+    for (int slot = static_cast<int>(pool.live.size()) - 1; slot >= 0; slot--)
+    {
+        int i = pool.live[slot];
+
+        // Integration (what the rigid body did)
+        if (desc.useGravity)
+        {
+            pool.velY[i] += GRAVITY * deltaTime;
+        }
+
+        pool.velX[i] = Math::Clamp<float>(pool.velX[i], -MAX_SPEED_X, MAX_SPEED_X);
+        pool.velY[i] = Math::Clamp<float>(pool.velY[i], -MAX_SPEED_Y, MAX_SPEED_Y);
+
+        if (Math::NearlyZero(pool.velX[i], 1.0f))
+        {
+            pool.velX[i] = 0.0f;
+        }
+
+        if (pool.state[i] == ParticleState::Flying)
+        {
+            if (!MoveAndCollide(pool, i, deltaTime, true))
+            {
+                MoveAndCollide(pool, i, deltaTime, false);
+            }
+        }
+        else
+        {
+            // Exploding particles have no collider
+            pool.posX[i] += pool.velX[i] * deltaTime;
+            pool.posY[i] += pool.velY[i] * deltaTime;
+        }
+
+        // Lifetime and animation
+        if (pool.state[i] == ParticleState::Exploding)
+        {
+            pool.animTimer[i] += ANIM_FPS * deltaTime;
+            if (pool.animTimer[i] >= explodeFrames)
+            {
+                KillParticle(pool, i);
+            }
+            continue;
+        }
+
+        pool.lifetime[i] -= deltaTime;
+        if (pool.lifetime[i] <= 0.0f)
+        {
+            StartExplosion(pool, i);
+        }
+    }
+}
+
+bool ParticleEngine::MoveAndCollide(ParticlePool& pool, int i, float deltaTime, bool horizontal)
+{
+    const ParticlePoolDesc& desc = pool.desc;
+
+    if (horizontal)
+    {
+        pool.posX[i] += pool.velX[i] * deltaTime;
+    }
+    else
+    {
+        pool.posY[i] += pool.velY[i] * deltaTime;
+    }
+
+    Vector2 half(desc.colliderWidth / 2.0f, desc.colliderHeight / 2.0f);
+    Vector2 center(pool.posX[i], pool.posY[i]);
+    Vector2 boxMin = center - half;
+    Vector2 boxMax = center + half;
+
+    // Same axis test AABBColliderComponent::Detect*Collision uses
+    bool hasHit = false;
+    float hitOverlap = 0.0f;
+    AABBColliderComponent* hitCollider = nullptr;
+
+    auto TestBox = [&](const Vector2& bMin, const Vector2& bMax) {
+        return AABBColliderComponent::GetAxisOverlap(!horizontal, boxMin, boxMax, bMin, bMax, pool.velY[i], hitOverlap);
+    };
+
+    Vector2 pad(static_cast<float>(Game::TILE_SIZE), static_cast<float>(Game::TILE_SIZE));
+
+    // Terrain first, straight from the level grid
+    TileMapCollider* tileMap = mGame->GetTileMap();
+    Vector2 hitCellMin, hitCellMax;
+    if (tileMap)
+    {
+        tileMap->ForEachSolidCell(boxMin - pad, boxMax + pad, [&](const Vector2& cellMin, const Vector2& cellMax) {
+            if (!hasHit && TestBox(cellMin, cellMax))
+            {
+                hasHit = true;
+                hitCellMin = cellMin;
+                hitCellMax = cellMax;
+            }
+        });
+
+        if (hasHit)
+        {
+            hitCollider = tileMap->GetProxy(hitCellMin, hitCellMax);
+        }
+    }
+
+    if (!hasHit)
+    {
+        mNearby.clear();
+        mGame->GetCollisionGrid()->Query(boxMin - pad, boxMax + pad, mNearby);
+
+        for (auto collider : mNearby)
+        {
+            // Triggers never stopped a particle
+            if (!collider->IsEnabled() || collider->IsTrigger())
+            {
+                continue;
+            }
+
+            if (TestBox(collider->GetMin(), collider->GetMax()))
+            {
+                hasHit = true;
+                hitCollider = collider;
+                break;
+            }
+        }
+    }
+
+    if (!hasHit)
+    {
+        return false;
+    }
+
+    // Pushed out like a body; the velocity is left alone, the particle explodes anyway
+    Vector2 position(pool.posX[i], pool.posY[i]);
+    Vector2 velocity(pool.velX[i], pool.velY[i]);
+    AABBColliderComponent::ResolveOverlap(!horizontal, hitOverlap, position, velocity);
+    pool.posX[i] = position.x;
+    pool.posY[i] = position.y;
+
+    // Copied: the callback may emit into this pool
+    CollisionCallback callback = pool.onCollision;
+    StartExplosion(pool, i);
+    if (callback)
+    {
+        callback(hitCollider);
+    }
+
+    return true;
+}
+
+void ParticleEngine::StartExplosion(ParticlePool& pool, int i)
+{
+    pool.state[i] = ParticleState::Exploding;
+    pool.animTimer[i] = 0.0f;
+    pool.velX[i] = 0.0f;
+    pool.velY[i] = 0.0f;
+}
+
+void ParticleEngine::KillParticle(ParticlePool& pool, int i)
+{
+    int slot = pool.liveSlot[i];
+    int last = pool.live.back();
+
+    pool.live[slot] = last;
+    pool.liveSlot[last] = slot;
+    pool.live.pop_back();
+
+    pool.liveSlot[i] = -1;
+    pool.state[i] = ParticleState::Dead;
+    pool.freeList.emplace_back(i);
+}
+
+void ParticleEngine::Draw(Renderer* renderer)
+{
+    Vector2 cameraPos = mGame->GetCameraPos();
+
+    // Menus draw at zoom 1, so never assume a smaller view than that
+    float zoom = Math::Min(mGame->GetZoomScale(), 1.0f);
+    Vector2 viewMin = cameraPos;
+    Vector2 viewMax = cameraPos + Vector2(Game::WINDOW_WIDTH / zoom, Game::WINDOW_HEIGHT / zoom);
+
+    for (auto pool : mPools)
+    {
+        const ParticlePoolDesc& desc = pool->desc;
+        if (!desc.sheet || pool->live.empty())
+        {
+            continue;
+        }
+
+        const auto& frames = desc.sheet->frames;
+        Vector2 size(static_cast<float>(desc.width), static_cast<float>(desc.height));
+        Vector2 half = size * 0.5f;
+
+        for (int i : pool->live)
+        {
+            Vector2 drawPos(pool->posX[i] + desc.drawOffset.x, pool->posY[i] + desc.drawOffset.y);
+            if (drawPos.x + half.x < viewMin.x || drawPos.x - half.x > viewMax.x ||
+                drawPos.y + half.y < viewMin.y || drawPos.y - half.y > viewMax.y)
+            {
+                continue;
+            }
+
+            int frame = desc.flyFrame;
+            if (pool->state[i] == ParticleState::Exploding)
+            {
+                int step = Math::Min(static_cast<int>(pool->animTimer[i]), desc.explodeFrameCount - 1);
+                frame = desc.explodeFirstFrame + step;
+            }
+
+            if (frame < 0 || frame >= static_cast<int>(frames.size()))
+            {
+                continue;
+            }
+
+            renderer->DrawTexture(drawPos, size, pool->rotation[i], Vector3::One,
+                                  frames[frame].texture, frames[frame].texRect, cameraPos);
+        }
+    }
+}
+
+void ParticleEngine::Clear()
+{
+    for (auto pool : mPools)
+    {
+        delete pool;
+    }
+    mPools.clear();
+
+    // Owned by the scene, which is being torn down with it
+    mDrawActor = nullptr;
+}
+
+void ParticleEngine::CollectLights(FrameVector<Vector2>& positions, FrameVector<float>& radii,
+                                   FrameVector<Vector3>& colors, size_t maxLights) const
+{
+    for (auto pool : mPools)
+    {
+        for (int i : pool->live)
+        {
+            if (positions.size() >= maxLights)
+            {
+                return;
+            }
+
+            positions.emplace_back(pool->posX[i], pool->posY[i]);
+            radii.emplace_back(100.0f);
+            colors.emplace_back(1.0f, 1.0f, 0.0f); // Yellow tint
+        }
+    }
+}
+
+int ParticleEngine::GetLiveCount() const
+{
+    int count = 0;
+    for (auto pool : mPools)
+    {
+        count += static_cast<int>(pool->live.size());
+    }
+    return count;
+}
+
+ParticleEngine::ParticlePool* ParticleEngine::FindPool(int id) const
+{
+    for (auto pool : mPools)
+    {
+        if (pool->id == id)
+        {
+            return pool;
+        }
+    }
+    return nullptr;
+}
+
+void ParticleEngine::EnsureDrawActor()
+{
+    if (mDrawActor)
+    {
+        return;
+    }
+
+    mDrawActor = new Actor(mGame);
+    new ParticleDrawComponent(mDrawActor, this);
+}
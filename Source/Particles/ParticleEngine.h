@@ -0,0 +1,112 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../Math.h"
+#include "../Memory/FrameArena.h"
+
+struct SpriteSheet;
+
+// Settings shared by every particle of a pool
+struct ParticlePoolDesc
+{
+    int width = 16;
+    int height = 16;
+    int colliderWidth = 8;
+    int colliderHeight = 8;
+    Vector2 drawOffset = Vector2::Zero;
+    bool useGravity = false;
+    int capacity = 100;
+
+    std::shared_ptr<const SpriteSheet> sheet;
+    // Sheet frames: one while flying, then a short non-looping explosion
+    int flyFrame = 0;
+    int explodeFirstFrame = 1;
+    int explodeFrameCount = 3;
+};
+
+// Owns every particle of the scene. Particles are plain data in
+// structure-of-arrays pools instead of actors with components: the update
+// walks only the live ones, and emission pops a free list. Pools outlive
+// the component that created them until their last particle dies.
+class ParticleEngine
+{
+public:
+    using CollisionCallback = std::function<void(class AABBColliderComponent*)>;
+
+    explicit ParticleEngine(class Game* game);
+    ~ParticleEngine();
+
+    // Returns the pool handle (never 0)
+    int CreatePool(const ParticlePoolDesc& desc);
+    // The pool keeps simulating its live particles and is freed once they are gone
+    void ReleasePool(int pool);
+
+    void SetCollisionCallback(int pool, CollisionCallback callback);
+
+    // Drops the particle when the pool has no free slot
+    void Emit(int pool, const Vector2& position, float rotation, const Vector2& velocity, float lifetime);
+
+    void Update(float deltaTime);
+    void Draw(class Renderer* renderer);
+
+    // Forgets every pool (scene unload); handles held by components become stale
+    void Clear();
+
+    // Appends the live particles as lights, stopping at maxLights in total
+    void CollectLights(FrameVector<Vector2>& positions, FrameVector<float>& radii,
+                       FrameVector<Vector3>& colors, size_t maxLights) const;
+
+    int GetLiveCount() const;
+
+private:
+    enum class ParticleState : uint8_t
+    {
+        Dead,
+        Flying,
+        Exploding
+    };
+
+    struct ParticlePool
+    {
+        int id;
+        ParticlePoolDesc desc;
+        CollisionCallback onCollision;
+        bool isReleased;
+
+        std::vector<float> posX;
+        std::vector<float> posY;
+        std::vector<float> velX;
+        std::vector<float> velY;
+        std::vector<float> rotation;
+        std::vector<float> lifetime;
+        std::vector<float> animTimer;
+        std::vector<ParticleState> state;
+
+        // Indices of live particles, and each particle's slot in it (-1 when dead)
+        std::vector<int> live;
+        std::vector<int> liveSlot;
+        std::vector<int> freeList;
+    };
+
+    ParticlePool* FindPool(int id) const;
+
+    void UpdatePool(ParticlePool& pool, float deltaTime);
+    // Moves one axis and returns true if the particle hit something
+    bool MoveAndCollide(ParticlePool& pool, int index, float deltaTime, bool horizontal);
+    void StartExplosion(ParticlePool& pool, int index);
+    void KillParticle(ParticlePool& pool, int index);
+
+    void EnsureDrawActor();
+
+    class Game* mGame;
+    std::vector<ParticlePool*> mPools;
+    int mNextPoolId;
+
+    // Scratch list for broadphase queries
+    std::vector<class AABBColliderComponent*> mNearby;
+
+    // Draws the particles at the regular draw order; belongs to the scene
+    class Actor* mDrawActor;
+};
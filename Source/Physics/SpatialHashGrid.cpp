@@ -0,0 +1,233 @@
+#include "SpatialHashGrid.h"
+#include "../Components/Physics/AABBColliderComponent.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+    : mCellSize(cellSize)
+    , mInvCellSize(1.0f / cellSize)
+    , mGeneration(1)
+    , mNextSequence(0)
+    , mQueryStamp(0)
+{
+}
+
+long long SpatialHashGrid::GetCellKey(int x, int y) const
+{
+    return (static_cast<long long>(x) << 32) ^ static_cast<unsigned int>(y);
+}
+
+void SpatialHashGrid::ComputeCellRange(const Vector2& min, const Vector2& max, int& minX, int& minY, int& maxX, int& maxY) const
+{
+    minX = static_cast<int>(std::floor(min.x * mInvCellSize));
+    minY = static_cast<int>(std::floor(min.y * mInvCellSize));
+    maxX = static_cast<int>(std::floor(max.x * mInvCellSize));
+    maxY = static_cast<int>(std::floor(max.y * mInvCellSize));
+}
+
+void SpatialHashGrid::Insert(AABBColliderComponent* collider, bool isDynamic)
+{
+    BroadphaseProxy& proxy = collider->mBroadphase;
+    proxy = BroadphaseProxy();
+    proxy.generation = mGeneration;
+    proxy.sequence = mNextSequence++;
+    proxy.isPending = true;
+    mPending.emplace_back(collider);
+
+    if (isDynamic)
+    {
+        proxy.dynamicIndex = static_cast<int>(mDynamic.size());
+        mDynamic.emplace_back(collider);
+    }
+}
+
+void SpatialHashGrid::Remove(AABBColliderComponent* collider)
+{
+    BroadphaseProxy& proxy = collider->mBroadphase;
+    if (proxy.generation != mGeneration)
+    {
+        // Registered before the last Clear (or never registered at all)
+        return;
+    }
+
+    if (proxy.isPending)
+    {
+        auto iter = std::find(mPending.begin(), mPending.end(), collider);
+        if (iter != mPending.end())
+        {
+            std::iter_swap(iter, mPending.end() - 1);
+            mPending.pop_back();
+        }
+    }
+    else
+    {
+        RemoveFromCells(collider);
+    }
+
+    if (proxy.dynamicIndex >= 0)
+    {
+        AABBColliderComponent* last = mDynamic.back();
+        mDynamic[proxy.dynamicIndex] = last;
+        last->mBroadphase.dynamicIndex = proxy.dynamicIndex;
+        mDynamic.pop_back();
+    }
+
+    proxy = BroadphaseProxy();
+}
+
+void SpatialHashGrid::Update(AABBColliderComponent* collider)
+{
+    BroadphaseProxy& proxy = collider->mBroadphase;
+    if (proxy.generation != mGeneration || proxy.isPending)
+    {
+        return;
+    }
+
+    int minX, minY, maxX, maxY;
+    ComputeCellRange(collider->GetMin(), collider->GetMax(), minX, minY, maxX, maxY);
+
+    if (minX == proxy.minX && minY == proxy.minY && maxX == proxy.maxX && maxY == proxy.maxY)
+    {
+        return;
+    }
+
+    RemoveFromCells(collider);
+    AddToCells(collider);
+}
+
+void SpatialHashGrid::UpdateDynamic()
+{
+    FlushPending();
+
+    for (auto collider : mDynamic)
+    {
+        Update(collider);
+    }
+}
+
+void SpatialHashGrid::Clear()
+{
+    mCells.clear();
+    mOversized.clear();
+    mDynamic.clear();
+    mPending.clear();
+
+    // Invalidates every proxy still held by colliders of the old scene
+    mGeneration++;
+}
+
+template <typename Allocator>
+void SpatialHashGrid::Query(const Vector2& min, const Vector2& max, std::vector<AABBColliderComponent*, Allocator>& out)
+{
+    FlushPending();
+
+    mQueryStamp++;
+    size_t start = out.size();
+
+    int minX, minY, maxX, maxY;
+    ComputeCellRange(min, max, minX, minY, maxX, maxY);
+
+    for (int y = minY; y <= maxY; y++)
+    {
+        for (int x = minX; x <= maxX; x++)
+        {
+            auto iter = mCells.find(GetCellKey(x, y));
+            if (iter == mCells.end())
+            {
+                continue;
+            }
+
+            for (auto collider : iter->second)
+            {
+                if (collider->mBroadphase.queryStamp != mQueryStamp)
+                {
+                    collider->mBroadphase.queryStamp = mQueryStamp;
+                    out.emplace_back(collider);
+                }
+            }
+        }
+    }
+
+    for (auto collider : mOversized)
+    {
+        out.emplace_back(collider);
+    }
+
+    // Keep the same order the colliders were registered in, like the old linear scan
+    std::sort(out.begin() + start, out.end(), [](AABBColliderComponent* a, AABBColliderComponent* b) {
+        return a->mBroadphase.sequence < b->mBroadphase.sequence;
+    });
+}
+
+template void SpatialHashGrid::Query(const Vector2&, const Vector2&, std::vector<AABBColliderComponent*>&);
+template void SpatialHashGrid::Query(const Vector2&, const Vector2&, FrameVector<AABBColliderComponent*>&);
+
+void SpatialHashGrid::FlushPending()
+{
+    for (auto collider : mPending)
+    {
+        collider->mBroadphase.isPending = false;
+        AddToCells(collider);
+    }
+    mPending.clear();
+}
+
+void SpatialHashGrid::AddToCells(AABBColliderComponent* collider)
+{
+    BroadphaseProxy& proxy = collider->mBroadphase;
+    ComputeCellRange(collider->GetMin(), collider->GetMax(), proxy.minX, proxy.minY, proxy.maxX, proxy.maxY);
+
+    long long numCells = static_cast<long long>(proxy.maxX - proxy.minX + 1) * (proxy.maxY - proxy.minY + 1);
+    if (numCells > MAX_CELLS_PER_COLLIDER)
+    {
+        proxy.isOversized = true;
+        mOversized.emplace_back(collider);
+        return;
+    }
+
+    proxy.isOversized = false;
+    for (int y = proxy.minY; y <= proxy.maxY; y++)
+    {
+        for (int x = proxy.minX; x <= proxy.maxX; x++)
+        {
+            mCells[GetCellKey(x, y)].emplace_back(collider);
+        }
+    }
+}
+
+void SpatialHashGrid::RemoveFromCells(AABBColliderComponent* collider)
+{
+    BroadphaseProxy& proxy = collider->mBroadphase;
+
+    if (proxy.isOversized)
+    {
+        auto iter = std::find(mOversized.begin(), mOversized.end(), collider);
+        if (iter != mOversized.end())
+        {
+            std::iter_swap(iter, mOversized.end() - 1);
+            mOversized.pop_back();
+        }
+        proxy.isOversized = false;
+        return;
+    }
+
+    for (int y = proxy.minY; y <= proxy.maxY; y++)
+    {
+        for (int x = proxy.minX; x <= proxy.maxX; x++)
+        {
+            auto cell = mCells.find(GetCellKey(x, y));
+            if (cell == mCells.end())
+            {
+                continue;
+            }
+
+            auto& colliders = cell->second;
+            auto iter = std::find(colliders.begin(), colliders.end(), collider);
+            if (iter != colliders.end())
+            {
+                std::iter_swap(iter, colliders.end() - 1);
+                colliders.pop_back();
+            }
+        }
+    }
+}
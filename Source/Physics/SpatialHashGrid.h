@@ -0,0 +1,79 @@
+#pragma once
+#include <unordered_map>
+#include <vector>
+#include "../Math.h"
+#include "../Memory/FrameArena.h"
+
+// Per-collider bookkeeping owned by the SpatialHashGrid
+struct BroadphaseProxy
+{
+    // Cell range the collider is currently bucketed in (inclusive)
+    int minX = 0;
+    int minY = 0;
+    int maxX = -1;
+    int maxY = -1;
+
+    // Grid generation this proxy was registered in (0 = not registered)
+    unsigned int generation = 0;
+    // Registration order, used to return query results in a stable order
+    unsigned int sequence = 0;
+    // Last query that already returned this collider (dedups multi-cell colliders)
+    unsigned int queryStamp = 0;
+    // Index in the grid's dynamic list (-1 for static colliders)
+    int dynamicIndex = -1;
+
+    bool isPending = false;
+    bool isOversized = false;
+};
+
+// Uniform grid hashed by cell coordinate. Static colliders are bucketed once,
+// dynamic ones are re-bucketed only when their bounds cross into other cells.
+class SpatialHashGrid
+{
+public:
+    explicit SpatialHashGrid(float cellSize);
+
+    // Registers a collider. It is bucketed lazily on the next query, since
+    // actors are usually positioned right after their components are created.
+    void Insert(class AABBColliderComponent* collider, bool isDynamic);
+    void Remove(class AABBColliderComponent* collider);
+
+    // Re-buckets the collider if its bounds now touch a different set of cells
+    void Update(class AABBColliderComponent* collider);
+
+    // Re-buckets every dynamic collider that moved since the last call
+    void UpdateDynamic();
+
+    // Forgets every collider at once (used when the scene is unloaded)
+    void Clear();
+
+    // Appends every collider whose cells overlap [min, max], in registration order.
+    // Defined for std::vector and FrameVector
+    template <typename Allocator>
+    void Query(const Vector2& min, const Vector2& max, std::vector<class AABBColliderComponent*, Allocator>& out);
+
+    float GetCellSize() const { return mCellSize; }
+
+private:
+    // Colliders spanning more cells than this are kept in a separate list
+    static const int MAX_CELLS_PER_COLLIDER = 256;
+
+    long long GetCellKey(int x, int y) const;
+    void ComputeCellRange(const Vector2& min, const Vector2& max, int& minX, int& minY, int& maxX, int& maxY) const;
+
+    void FlushPending();
+    void AddToCells(class AABBColliderComponent* collider);
+    void RemoveFromCells(class AABBColliderComponent* collider);
+
+    float mCellSize;
+    float mInvCellSize;
+
+    std::unordered_map<long long, std::vector<class AABBColliderComponent*>> mCells;
+    std::vector<class AABBColliderComponent*> mOversized;
+    std::vector<class AABBColliderComponent*> mDynamic;
+    std::vector<class AABBColliderComponent*> mPending;
+
+    unsigned int mGeneration;
+    unsigned int mNextSequence;
+    unsigned int mQueryStamp;
+};
@@ -0,0 +1,37 @@
+#include "TileMapCollider.h"
+#include "../Game.h"
+#include "../Actors/Actor.h"
+#include "../Components/Physics/AABBColliderComponent.h"
+
+TileMapCollider::TileMapCollider(Game* game, int** levelData, int width, int height, int tileSize)
+    : mLevelData(levelData)
+    , mWidth(width)
+    , mHeight(height)
+    , mTileSize(tileSize)
+    , mProxyActor(nullptr)
+    , mProxyCollider(nullptr)
+{
+    mProxyActor = new Actor(game);
+    mProxyActor->SetState(ActorState::Paused);
+
+    mProxyCollider = new AABBColliderComponent(mProxyActor, 0, 0, tileSize, tileSize, ColliderLayer::Blocks, false, true);
+
+    // Disabled so the regular collider queries skip it; tiles are reported through GetProxy
+    mProxyCollider->SetEnabled(false);
+}
+
+bool TileMapCollider::IsSolid(int row, int col) const
+{
+    if (row < 0 || row >= mHeight || col < 0 || col >= mWidth)
+    {
+        return false;
+    }
+
+    return mLevelData[row][col] > 0;
+}
+
+AABBColliderComponent* TileMapCollider::GetProxy(const Vector2& cellMin, const Vector2& cellMax)
+{
+    mProxyActor->SetPosition((cellMin + cellMax) * 0.5f);
+    return mProxyCollider;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cmath>
+#include "../Math.h"
+
+// Answers terrain collision queries straight from the level grid, so
+// collidable tiles don't need an actor and a collider each.
+class TileMapCollider
+{
+public:
+    // levelData is not owned: it is the grid Game fills in BuildLevelFromJSON
+    // (-1 for empty cells, the tile id otherwise)
+    TileMapCollider(class Game* game, int** levelData, int width, int height, int tileSize);
+
+    bool IsSolid(int row, int col) const;
+
+    int GetWidth() const { return mWidth; }
+    int GetHeight() const { return mHeight; }
+    int GetTileSize() const { return mTileSize; }
+
+    // Calls func(cellMin, cellMax) for every solid cell touched by [min, max]
+    template <typename Func>
+    void ForEachSolidCell(const Vector2& min, const Vector2& max, Func&& func) const
+    {
+        const float tileSize = static_cast<float>(mTileSize);
+
+        int minCol = Math::Max(static_cast<int>(std::floor(min.x / tileSize)), 0);
+        int minRow = Math::Max(static_cast<int>(std::floor(min.y / tileSize)), 0);
+        int maxCol = Math::Min(static_cast<int>(std::floor(max.x / tileSize)), mWidth - 1);
+        int maxRow = Math::Min(static_cast<int>(std::floor(max.y / tileSize)), mHeight - 1);
+
+        for (int row = minRow; row <= maxRow; row++)
+        {
+            for (int col = minCol; col <= maxCol; col++)
+            {
+                if (mLevelData[row][col] > 0)
+                {
+                    func(Vector2(col * tileSize, row * tileSize),
+                         Vector2((col + 1) * tileSize, (row + 1) * tileSize));
+                }
+            }
+        }
+    }
+
+    // Collider handed to collision callbacks as the "other" side of a tile hit.
+    // It is moved onto the given cell so GetMin/GetMax/GetOwner stay meaningful.
+    class AABBColliderComponent* GetProxy(const Vector2& cellMin, const Vector2& cellMax);
+
+private:
+    int** mLevelData;
+    int mWidth;
+    int mHeight;
+    int mTileSize;
+
+    // Owned by the scene like any other actor
+    class Actor* mProxyActor;
+    class AABBColliderComponent* mProxyCollider;
+};
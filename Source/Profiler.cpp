@@ -0,0 +1,148 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <SDL.h>
+
+namespace
+{
+    struct ZoneEvent
+    {
+        const char* name;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    // One per thread that ever entered a zone; only that thread writes to it
+    struct ThreadRing
+    {
+        uint32_t threadId;
+        std::string name;
+        std::vector<ZoneEvent> events;
+        std::atomic<uint64_t> written{0};
+    };
+
+    std::mutex sRingsMutex;
+    std::vector<std::unique_ptr<ThreadRing>> sRings;
+
+    ThreadRing* RegisterThread(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(sRingsMutex);
+        auto ring = std::make_unique<ThreadRing>();
+        ring->threadId = static_cast<uint32_t>(sRings.size() + 1);
+        ring->events.resize(capacity);
+        sRings.emplace_back(std::move(ring));
+        return sRings.back().get();
+    }
+
+    thread_local ThreadRing* tRing = nullptr;
+}
+
+Profiler::Zone::Zone(const char* name)
+    : mName(name)
+    , mStart(NowMicroseconds())
+{
+}
+
+Profiler::Zone::~Zone()
+{
+    Record(mName, mStart, NowMicroseconds());
+}
+
+uint64_t Profiler::NowMicroseconds()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::SetThreadName(const std::string& name)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    if (!tRing)
+    {
+        tRing = RegisterThread(RING_CAPACITY);
+    }
+
+    std::lock_guard<std::mutex> lock(sRingsMutex);
+    tRing->name = name;
+}
+
+void Profiler::Record(const char* name, uint64_t start, uint64_t end)
+{
+    if (!tRing)
+    {
+        tRing = RegisterThread(RING_CAPACITY);
+    }
+
+    uint64_t index = tRing->written.load(std::memory_order_relaxed);
+    tRing->events[index % RING_CAPACITY] = { name, start, end };
+    tRing->written.store(index + 1, std::memory_order_release);
+}
+
+bool Profiler::DumpChromeTrace(const std::string& fileName, float seconds)
+{
+    if (!IsEnabled())
+    {
+        SDL_Log("Profiler: zones are compiled out (configure with -DCONTRA_PROFILER=ON)");
+        return false;
+    }
+
+    std::ofstream file(fileName, std::ios::trunc);
+    if (!file.is_open())
+    {
+        SDL_Log("Profiler: failed to open %s", fileName.c_str());
+        return false;
+    }
+
+    uint64_t now = NowMicroseconds();
+    uint64_t windowUs = static_cast<uint64_t>(std::max(seconds, 0.0f) * 1000000.0f);
+    uint64_t from = now > windowUs ? now - windowUs : 0;
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    size_t count = 0;
+    std::lock_guard<std::mutex> lock(sRingsMutex);
+    for (const auto& ring : sRings)
+    {
+        if (!ring->name.empty())
+        {
+            file << (count > 0 ? ",\n" : "")
+                 << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1"
+                 << ",\"tid\":" << ring->threadId
+                 << ",\"args\":{\"name\":\"" << ring->name << "\"}}";
+            count++;
+        }
+
+        uint64_t written = ring->written.load(std::memory_order_acquire);
+        uint64_t first = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+
+        for (uint64_t i = first; i < written; i++)
+        {
+            const ZoneEvent& event = ring->events[i % RING_CAPACITY];
+            if (event.end < from)
+            {
+                continue;
+            }
+
+            file << (count > 0 ? ",\n" : "")
+                 << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1"
+                 << ",\"tid\":" << ring->threadId
+                 << ",\"ts\":" << event.start
+                 << ",\"dur\":" << (event.end - event.start) << "}";
+            count++;
+        }
+    }
+
+    file << "\n]}\n";
+
+    SDL_Log("Profiler: wrote %zu zones from the last %.1f s to %s", count, seconds, fileName.c_str());
+    return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Scoped CPU zones, recorded per thread into a ring buffer and dumped as
+// Chrome trace_event JSON (open it in chrome://tracing or Perfetto).
+// Zones only exist when built with ENABLE_PROFILER (CMake option
+// CONTRA_PROFILER); otherwise the macros expand to nothing.
+#ifdef ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+// name must outlive the program (a string literal)
+#define PROFILE_SCOPE(name) Profiler::Zone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#endif
+
+class Profiler
+{
+public:
+    class Zone
+    {
+    public:
+        explicit Zone(const char* name);
+        ~Zone();
+
+    private:
+        const char* mName;
+        uint64_t mStart;
+    };
+
+    static constexpr bool IsEnabled()
+    {
+#ifdef ENABLE_PROFILER
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Writes every zone that ended in the last `seconds`, from all threads.
+    // Call it from the main thread between frames.
+    static bool DumpChromeTrace(const std::string& fileName, float seconds);
+
+    // Label of the calling thread in the trace (job workers set theirs)
+    static void SetThreadName(const std::string& name);
+
+private:
+    // Zones kept per thread before the oldest are overwritten
+    static const size_t RING_CAPACITY = 1 << 16;
+
+    static void Record(const char* name, uint64_t start, uint64_t end);
+    static uint64_t NowMicroseconds();
+};
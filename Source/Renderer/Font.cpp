@@ -1,5 +1,6 @@
 #include "Font.h"
 #include "Texture.h"
+#include <algorithm>
 #include <vector>
 #include "../Game.h"
 
@@ -73,3 +74,68 @@ Texture* Font::RenderText(const std::string& text, const Vector3& color /*= Colo
 
 	return texture;
 }
+
+Texture* Font::RenderGlyphAtlas(const std::string& chars, std::vector<Vector4>& outRects,
+								std::vector<Vector2>& outSizes, int pointSize /*= 16*/)
+{
+	outRects.clear();
+	outSizes.clear();
+
+	auto iter = mFontData.find(pointSize);
+	if (iter == mFontData.end())
+	{
+		SDL_Log("Point size %d is unsupported", pointSize);
+		return nullptr;
+	}
+
+	SDL_Color white = { 255, 255, 255, 255 };
+	std::vector<SDL_Surface*> glyphs;
+	int width = 0;
+	int height = 0;
+	for (char c : chars)
+	{
+		char text[2] = { c, '\0' };
+		SDL_Surface* glyph = TTF_RenderUTF8_Blended(iter->second, text, white);
+		glyphs.emplace_back(glyph);
+		if (glyph)
+		{
+			width += glyph->w;
+			height = std::max(height, glyph->h);
+		}
+	}
+
+	Texture* texture = nullptr;
+	SDL_Surface* atlas = width > 0 ? SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32) : nullptr;
+	if (atlas)
+	{
+		int x = 0;
+		for (SDL_Surface* glyph : glyphs)
+		{
+			int w = glyph ? glyph->w : 0;
+			int h = glyph ? glyph->h : 0;
+			if (glyph)
+			{
+				// Straight copy, alpha included
+				SDL_SetSurfaceBlendMode(glyph, SDL_BLENDMODE_NONE);
+				SDL_Rect dst = { x, 0, w, h };
+				SDL_BlitSurface(glyph, nullptr, atlas, &dst);
+			}
+
+			outRects.emplace_back(Vector4(static_cast<float>(x) / width, 0.0f,
+										  static_cast<float>(w) / width, static_cast<float>(h) / height));
+			outSizes.emplace_back(Vector2(static_cast<float>(w), static_cast<float>(h)));
+			x += w;
+		}
+
+		texture = new Texture();
+		texture->CreateFromSurface(atlas);
+		SDL_FreeSurface(atlas);
+	}
+
+	for (SDL_Surface* glyph : glyphs)
+	{
+		if (glyph) SDL_FreeSurface(glyph);
+	}
+
+	return texture;
+}
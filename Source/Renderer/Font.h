@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <SDL_ttf.h>
 #include "../Math.h"
 
@@ -18,6 +19,12 @@ public:
 	class Texture* RenderText(const std::string& text, const Vector3& color = Color::White,
 							  int pointSize = 30, unsigned wrapLength = 900);
 
+	// Renders each character of chars once, side by side, into a single white
+	// texture (tint it when drawing). outRects gets each character's texture
+	// rect and outSizes its size in pixels, in the order of chars
+	class Texture* RenderGlyphAtlas(const std::string& chars, std::vector<Vector4>& outRects,
+									std::vector<Vector2>& outSizes, int pointSize = 16);
+
 private:
 	// Map of point sizes to font data
 	std::unordered_map<int, TTF_Font*> mFontData;
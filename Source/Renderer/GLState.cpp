@@ -0,0 +1,101 @@
+#include "GLState.h"
+#include <GL/glew.h>
+
+unsigned int GLState::sProgram = 0;
+unsigned int GLState::sVertexArray = 0;
+unsigned int GLState::sTextures[GLState::MAX_TEXTURE_UNITS] = {};
+int GLState::sActiveUnit = 0;
+bool GLState::sHasContext = false;
+GLState::Stats GLState::sFrameStats;
+GLState::Stats GLState::sLastFrameStats;
+
+void GLState::UseProgram(unsigned int program)
+{
+	if (program == sProgram)
+	{
+		sFrameStats.programBindsSkipped++;
+		return;
+	}
+
+	glUseProgram(program);
+	sProgram = program;
+	sFrameStats.programBinds++;
+}
+
+void GLState::BindTexture(unsigned int texture, int unit)
+{
+	if (texture == sTextures[unit])
+	{
+		sFrameStats.textureBindsSkipped++;
+		return;
+	}
+
+	if (unit != sActiveUnit)
+	{
+		glActiveTexture(GL_TEXTURE0 + unit);
+		sActiveUnit = unit;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	sTextures[unit] = texture;
+	sFrameStats.textureBinds++;
+}
+
+void GLState::BindVertexArray(unsigned int vertexArray)
+{
+	if (vertexArray == sVertexArray)
+	{
+		sFrameStats.vertexArrayBindsSkipped++;
+		return;
+	}
+
+	glBindVertexArray(vertexArray);
+	sVertexArray = vertexArray;
+	sFrameStats.vertexArrayBinds++;
+}
+
+void GLState::OnProgramDeleted(unsigned int program)
+{
+	if (program == sProgram)
+	{
+		sProgram = 0;
+	}
+}
+
+void GLState::OnTextureDeleted(unsigned int texture)
+{
+	// GL unbinds a deleted texture from every unit
+	for (auto& bound : sTextures)
+	{
+		if (bound == texture)
+		{
+			bound = 0;
+		}
+	}
+}
+
+void GLState::OnVertexArrayDeleted(unsigned int vertexArray)
+{
+	if (vertexArray == sVertexArray)
+	{
+		sVertexArray = 0;
+	}
+}
+
+void GLState::CountUniform(bool skipped)
+{
+	if (skipped)
+	{
+		sFrameStats.uniformUploadsSkipped++;
+	}
+	else
+	{
+		sFrameStats.uniformUploads++;
+	}
+}
+
+void GLState::EndFrame()
+{
+	sLastFrameStats = sFrameStats;
+	sFrameStats = Stats();
+}
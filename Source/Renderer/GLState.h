@@ -0,0 +1,53 @@
+#pragma once
+
+// Mirrors the GL bindings the renderer touches so redundant binds and
+// uniform uploads can be skipped. Every bind in the renderer goes through here.
+class GLState
+{
+public:
+	struct Stats
+	{
+		int programBinds = 0;
+		int programBindsSkipped = 0;
+		int textureBinds = 0;
+		int textureBindsSkipped = 0;
+		int vertexArrayBinds = 0;
+		int vertexArrayBindsSkipped = 0;
+		int uniformUploads = 0;
+		int uniformUploadsSkipped = 0;
+	};
+
+	static void UseProgram(unsigned int program);
+	static void BindTexture(unsigned int texture, int unit = 0);
+	static void BindVertexArray(unsigned int vertexArray);
+
+	// Deleted names may be handed out again by GL, so forget them
+	static void OnProgramDeleted(unsigned int program);
+	static void OnTextureDeleted(unsigned int texture);
+	static void OnVertexArrayDeleted(unsigned int vertexArray);
+
+	// Called by Shader for every uniform set, uploaded or not
+	static void CountUniform(bool skipped);
+
+	// Rolls the current counters into the last frame ones
+	static void EndFrame();
+
+	static const Stats& GetLastFrameStats() { return sLastFrameStats; }
+
+	// False in headless runs: textures and vertex arrays keep their metadata
+	// but never create GL objects
+	static void SetContextAvailable(bool available) { sHasContext = available; }
+	static bool HasContext() { return sHasContext; }
+
+private:
+	static const int MAX_TEXTURE_UNITS = 8;
+
+	static unsigned int sProgram;
+	static unsigned int sVertexArray;
+	static unsigned int sTextures[MAX_TEXTURE_UNITS];
+	static int sActiveUnit;
+	static bool sHasContext;
+
+	static Stats sFrameStats;
+	static Stats sLastFrameStats;
+};
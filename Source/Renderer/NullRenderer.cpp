@@ -0,0 +1,18 @@
+#include "NullRenderer.h"
+#include "GLState.h"
+
+NullRenderer::NullRenderer()
+    : Renderer(nullptr)
+{
+}
+
+bool NullRenderer::Initialize(float /*width*/, float /*height*/)
+{
+    GLState::SetContextAvailable(false);
+    return true;
+}
+
+void NullRenderer::Shutdown()
+{
+    UnloadResources();
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "Renderer.h"
+
+// Renderer for headless runs: no window and no GL context. Textures and
+// sprite sheets still load so actors get their sizes and frame rects, but
+// nothing is uploaded and every draw is dropped.
+class NullRenderer : public Renderer
+{
+public:
+    NullRenderer();
+
+    bool Initialize(float width, float height) override;
+    void Shutdown() override;
+
+    void SetZoom(float /*zoom*/) override {}
+
+    void DrawRect(const Vector2 &/*position*/, const Vector2 &/*size*/, float /*rotation*/,
+                  const Vector3 &/*color*/, const Vector2 &/*cameraPos*/, RendererMode /*mode*/, float /*alpha*/ = 1.0f) override {}
+
+    void DrawTexture(const Vector2 &/*position*/, const Vector2 &/*size*/, float /*rotation*/,
+                     const Vector3 &/*color*/, Texture * /*texture*/,
+                     const Vector4 &/*textureRect*/ = Vector4::UnitRect,
+                     const Vector2 &/*cameraPos*/ = Vector2::Zero, const Vector2 &/*scale*/ = Vector2(1.0f, 1.0f),
+                     float /*textureFactor*/ = 1.0f, float /*alpha*/ = 1.0f, bool /*isVegetation*/ = false, bool /*isCircle*/ = false) override {}
+
+    void DrawGeometry(const Vector2 &/*position*/, const Vector2 &/*size*/, float /*rotation*/,
+                      const Vector3 &/*color*/, const Vector2 &/*cameraPos*/, VertexArray * /*vertexArray*/, RendererMode /*mode*/) override {}
+
+    void DrawWorldGeometry(VertexArray * /*vertexArray*/, Texture * /*texture*/, const Vector2 &/*cameraPos*/,
+                           const Vector3 &/*color*/ = Vector3::One, float /*alpha*/ = 1.0f) override {}
+
+    void Clear() override {}
+    void Present() override {}
+    void FlushSpriteBatch() override {}
+
+    void DrawUI(class Shader* /*shader*/) override {}
+
+    void SetLightUniforms(const FrameVector<Vector2>& /*lightPos*/, const FrameVector<float>& /*lightRadii*/,
+                          const FrameVector<Vector3>& /*lightColors*/, const Vector3& /*ambient*/) override {}
+    void SetFlashlightUniforms(bool /*active*/, const Vector2& /*pos*/, const Vector2& /*dir*/) override {}
+    void SetActiveShader(class Shader* /*shader*/) override {}
+};
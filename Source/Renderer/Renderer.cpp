@@ -1,19 +1,34 @@
 #include <GL/glew.h>
 #include <SDL_ttf.h>
+#include <cstddef>
 #include "Renderer.h"
 #include "Shader.h"
+#include "GLState.h"
 #include "VertexArray.h"
 #include "Texture.h"
 #include "Font.h"
 #include "../UI/UIElement.h"
+#include "../Profiler.h"
 
 Renderer::Renderer(SDL_Window *window)
 : mBaseShader(nullptr)
 , mLightShader(nullptr)
 , mActiveShader(nullptr)
+, mSpriteVerts(nullptr)
 , mWindow(window)
 , mContext(nullptr)
 , mOrthoProjection(Matrix4::Identity)
+, mZoom(1.0f)
+, mBatchTexture(nullptr)
+, mBatchCameraPos(Vector2::Zero)
+, mBatchVertexArray(0)
+, mBatchVertexBuffer(0)
+, mBatchIndexBuffer(0)
+, mTime(0.0f)
+, mFrameDrawCalls(0)
+, mFrameBatchedSprites(0)
+, mLastFrameDrawCalls(0)
+, mLastFrameBatchedSprites(0)
 {
 
 }
@@ -57,6 +72,7 @@ bool Renderer::Initialize(float width, float height)
         SDL_Log("Failed to initialize GLEW.");
         return false;
     }
+    GLState::SetContextAvailable(true);
 
 	// Make sure we can create/compile shaders
 	if (!LoadShaders()) {
@@ -66,6 +82,7 @@ bool Renderer::Initialize(float width, float height)
 
     // Create quad for drawing sprites
     CreateSpriteVerts();
+    CreateSpriteBatch();
 
     // Set the clear color to light grey
     glClearColor(0.419f, 0.549f, 1.0f, 1.0f);
@@ -98,6 +115,28 @@ bool Renderer::Initialize(float width, float height)
 
 void Renderer::Shutdown()
 {
+    UnloadResources();
+
+    glDeleteBuffers(1, &mBatchVertexBuffer);
+    glDeleteBuffers(1, &mBatchIndexBuffer);
+    GLState::OnVertexArrayDeleted(mBatchVertexArray);
+    glDeleteVertexArrays(1, &mBatchVertexArray);
+
+    mBaseShader->Unload();
+    delete mBaseShader;
+
+    TTF_Quit();
+
+    GLState::SetContextAvailable(false);
+    SDL_GL_DeleteContext(mContext);
+	SDL_DestroyWindow(mWindow);
+}
+
+void Renderer::UnloadResources()
+{
+    // Sheets point at the textures below
+    mSpriteSheets.Clear();
+
     // Destroy textures
     for (auto i : mTextures)
     {
@@ -112,18 +151,19 @@ void Renderer::Shutdown()
         delete i.second;
     }
     mFonts.clear();
-
-    mBaseShader->Unload();
-    delete mBaseShader;
-
-    TTF_Quit();
-
-    SDL_GL_DeleteContext(mContext);
-	SDL_DestroyWindow(mWindow);
 }
 
 void Renderer::SetZoom(float zoom)
 {
+    // Called every frame; only touch the shaders when the zoom actually changes
+    if (zoom == mZoom)
+    {
+        return;
+    }
+
+    FlushSpriteBatch();
+    mZoom = zoom;
+
     float width = mScreenWidth / zoom;
     float height = mScreenHeight / zoom;
 
@@ -147,6 +187,9 @@ void Renderer::Clear()
 void Renderer::Draw(RendererMode mode, const Matrix4 &modelMatrix, const Vector2 &cameraPos, VertexArray *vertices,
                     const Vector3 &color, Texture *texture, const Vector4 &textureRect, float textureFactor, float alpha, bool isVegetation, bool isCircle)
 {
+    // Anything queued so far must land before this draw
+    FlushSpriteBatch();
+
     mActiveShader->SetMatrixUniform("uWorldTransform", modelMatrix);
     mActiveShader->SetVectorUniform("uColor", Vector4(color.x, color.y, color.z, 1.0f));
     mActiveShader->SetVectorUniform("uTexRect", textureRect);
@@ -166,7 +209,7 @@ void Renderer::Draw(RendererMode mode, const Matrix4 &modelMatrix, const Vector2
         mActiveShader->SetFloatUniform("uTextureFactor", textureFactor);
     }
     else {
-        glBindTexture(GL_TEXTURE_2D, 0);
+        GLState::BindTexture(0);
         mActiveShader->SetFloatUniform("uTextureFactor", 0.0f);
     }
 
@@ -178,11 +221,18 @@ void Renderer::Draw(RendererMode mode, const Matrix4 &modelMatrix, const Vector2
     {
         glDrawElements(GL_TRIANGLES, vertices->GetNumIndices(), GL_UNSIGNED_INT,nullptr);
     }
+    mFrameDrawCalls++;
 }
 
 void Renderer::DrawRect(const Vector2 &position, const Vector2 &size, float rotation, const Vector3 &color,
                         const Vector2 &cameraPos, RendererMode mode, float alpha)
 {
+    if (mode == RendererMode::TRIANGLES)
+    {
+        BatchQuad(position, size, rotation, color, nullptr, Vector4::UnitRect, cameraPos, 1.0f, alpha, false, false);
+        return;
+    }
+
     Matrix4 model = Matrix4::CreateScale(Vector3(size.x, size.y, 1.0f)) *
                     Matrix4::CreateRotationZ(rotation) *
                     Matrix4::CreateTranslation(Vector3(position.x, position.y, 0.0f));
@@ -194,11 +244,106 @@ void Renderer::DrawTexture(const Vector2 &position, const Vector2 &size, float r
                            Texture *texture, const Vector4 &textureRect, const Vector2 &cameraPos, const Vector2 &scale,
                            float textureFactor, float alpha, bool isVegetation, bool isCircle)
 {
-    Matrix4 model = Matrix4::CreateScale(Vector3(size.x * scale.x, size.y * scale.y, 1.0f)) *
-                    Matrix4::CreateRotationZ(rotation) *
-                    Matrix4::CreateTranslation(Vector3(position.x, position.y, 0.0f));
+    BatchQuad(position, Vector2(size.x * scale.x, size.y * scale.y), rotation, color, texture, textureRect,
+              cameraPos, textureFactor, alpha, isVegetation, isCircle);
+}
+
+void Renderer::BatchQuad(const Vector2 &position, const Vector2 &size, float rotation, const Vector3 &color,
+                         Texture *texture, const Vector4 &textureRect, const Vector2 &cameraPos,
+                         float textureFactor, float alpha, bool isVegetation, bool isCircle)
+{
+    // Untextured quads fit in any batch; a different texture or camera starts a new one
+    bool textureChanged = texture && mBatchTexture && texture != mBatchTexture;
+    bool cameraChanged = !mBatchVertices.empty() &&
+                         (cameraPos.x != mBatchCameraPos.x || cameraPos.y != mBatchCameraPos.y);
+    if (textureChanged || cameraChanged || mBatchVertices.size() >= MAX_BATCH_SPRITES * 4)
+    {
+        FlushSpriteBatch();
+    }
+
+    if (texture)
+    {
+        mBatchTexture = texture;
+    }
+    mBatchCameraPos = cameraPos;
+
+    // Same quad and UV layout as CreateSpriteVerts
+    static const float corners[4][2] = { {-0.5f, -0.5f}, {0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, 0.5f} };
+    static const float uvs[4][2] = { {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f} };
+
+    // Vegetation wiggle from Light.vert, applied here since the vertices are already in world space
+    float wiggle = 0.0f;
+    if (isVegetation && mActiveShader == mLightShader)
+    {
+        wiggle = Math::Sin(mTime * 3.0f + position.x * 0.1f) * 0.2f;
+    }
+
+    float cosR = Math::Cos(rotation);
+    float sinR = Math::Sin(rotation);
+
+    for (int i = 0; i < 4; i++)
+    {
+        float x = (corners[i][0] + wiggle * (0.5f - corners[i][1])) * size.x;
+        float y = corners[i][1] * size.y;
+
+        BatchVertex vertex;
+        vertex.x = x * cosR - y * sinR + position.x;
+        vertex.y = x * sinR + y * cosR + position.y;
+        vertex.u = uvs[i][0] * textureRect.z + textureRect.x;
+        vertex.v = uvs[i][1] * textureRect.w + textureRect.y;
+        vertex.r = color.x;
+        vertex.g = color.y;
+        vertex.b = color.z;
+        vertex.a = 1.0f;
+        vertex.globalAlpha = alpha;
+        vertex.textureFactor = texture ? textureFactor : 0.0f;
+        vertex.isCircle = isCircle ? 1.0f : 0.0f;
+
+        mBatchVertices.emplace_back(vertex);
+    }
 
-    Draw(RendererMode::TRIANGLES, model, cameraPos, mSpriteVerts, color, texture, textureRect, textureFactor, alpha, isVegetation, isCircle);
+    mFrameBatchedSprites++;
+}
+
+void Renderer::FlushSpriteBatch()
+{
+    if (mBatchVertices.empty())
+    {
+        return;
+    }
+
+    // Vertices are in world space with final UVs, colors and flags
+    mActiveShader->SetMatrixUniform("uWorldTransform", Matrix4::Identity);
+    mActiveShader->SetVectorUniform("uTexRect", Vector4::UnitRect);
+    mActiveShader->SetVectorUniform("uCameraPos", mBatchCameraPos);
+    mActiveShader->SetFloatUniform("uIsVegetation", 0.0f);
+    mActiveShader->SetFloatUniform("uUseVertexColor", 1.0f);
+
+    if (mBatchTexture)
+    {
+        mBatchTexture->SetActive();
+    }
+    else
+    {
+        GLState::BindTexture(0);
+    }
+
+    GLState::BindVertexArray(mBatchVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, mBatchVertexBuffer);
+
+    // Orphan the old storage so we never wait on the GPU still reading the previous batch
+    glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SPRITES * 4 * sizeof(BatchVertex), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, mBatchVertices.size() * sizeof(BatchVertex), mBatchVertices.data());
+
+    GLsizei numIndices = static_cast<GLsizei>(mBatchVertices.size() / 4 * 6);
+    glDrawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_INT, nullptr);
+    mFrameDrawCalls++;
+
+    // UI elements and the non-batched draws still use the per-draw uniforms
+    mActiveShader->SetFloatUniform("uUseVertexColor", 0.0f);
+
+    mBatchVertices.clear();
+    mBatchTexture = nullptr;
 }
 
 void Renderer::DrawGeometry(const Vector2 &position, const Vector2 &size, float rotation, const Vector3 &color,
@@ -211,8 +356,25 @@ void Renderer::DrawGeometry(const Vector2 &position, const Vector2 &size, float
     Draw(mode, model, cameraPos, vertexArray, color);
 }
 
+void Renderer::DrawWorldGeometry(VertexArray *vertexArray, Texture *texture, const Vector2 &cameraPos,
+                                 const Vector3 &color, float alpha)
+{
+    // Vertices carry world positions and final UVs, so no model transform or sub-rect
+    Draw(RendererMode::TRIANGLES, Matrix4::Identity, cameraPos, vertexArray, color, texture, Vector4::UnitRect, 1.0f, alpha);
+}
+
 void Renderer::Present()
 {
+    PROFILE_SCOPE("Renderer::Present");
+
+    FlushSpriteBatch();
+
+    mLastFrameDrawCalls = mFrameDrawCalls;
+    mLastFrameBatchedSprites = mFrameBatchedSprites;
+    mFrameDrawCalls = 0;
+    mFrameBatchedSprites = 0;
+    GLState::EndFrame();
+
 	// Swap the buffers
 	SDL_GL_SwapWindow(mWindow);
 }
@@ -254,6 +416,43 @@ void Renderer::CreateSpriteVerts()
     mSpriteVerts = new VertexArray(vertices, 4, indices, 6);
 }
 
+void Renderer::CreateSpriteBatch()
+{
+    mBatchVertices.reserve(MAX_BATCH_SPRITES * 4);
+
+    glGenVertexArrays(1, &mBatchVertexArray);
+    GLState::BindVertexArray(mBatchVertexArray);
+
+    // Streaming buffer, refilled on every flush
+    glGenBuffers(1, &mBatchVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBatchVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SPRITES * 4 * sizeof(BatchVertex), nullptr, GL_STREAM_DRAW);
+
+    // The index pattern never changes, so it is built once
+    std::vector<unsigned int> indices;
+    indices.reserve(MAX_BATCH_SPRITES * 6);
+    for (unsigned int i = 0; i < MAX_BATCH_SPRITES; i++)
+    {
+        unsigned int base = i * 4;
+        indices.insert(indices.end(), { base, base + 1, base + 2, base + 2, base + 3, base });
+    }
+
+    glGenBuffers(1, &mBatchIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBatchIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+
+    // Position, tex coord, color and (global alpha, texture factor, circle)
+    GLsizei stride = sizeof(BatchVertex);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(BatchVertex, x)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(BatchVertex, u)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(BatchVertex, r)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(offsetof(BatchVertex, globalAlpha)));
+}
+
 void Renderer::AddUIElement(UIElement* element)
 {
     mUIElements.emplace_back(element);
@@ -274,6 +473,9 @@ void Renderer::RemoveUIElement(UIElement* element)
 
 void Renderer::DrawUI(Shader* shader)
 {
+    // UI elements issue their own draws with the sprite quad
+    FlushSpriteBatch();
+
     shader->SetVectorUniform("uCameraPos", Vector2::Zero);
     shader->SetFloatUniform("uGlobalAlpha", 1.0f);
 
@@ -308,6 +510,28 @@ Texture* Renderer::GetTexture(const std::string& fileName)
     return tex;
 }
 
+size_t Renderer::GetTextureBytes() const
+{
+    size_t bytes = 0;
+    for (const auto& texture : mTextures)
+    {
+        bytes += static_cast<size_t>(texture.second->GetWidth()) * texture.second->GetHeight() * 4;
+    }
+    return bytes;
+}
+
+std::shared_ptr<const SpriteSheet> Renderer::GetSpriteSheet(const std::string& texturePath, const std::string& dataPath)
+{
+    Texture* texture = GetTexture(texturePath);
+    if (!texture)
+    {
+        SDL_Log("Failed to load sprite texture: %s", texturePath.c_str());
+        return nullptr;
+    }
+
+    return mSpriteSheets.Get(texture, dataPath);
+}
+
 Font* Renderer::GetFont(const std::string& fileName)
 {
     auto iter = mFonts.find(fileName);
@@ -332,11 +556,12 @@ Font* Renderer::GetFont(const std::string& fileName)
     }
 }
 
-void Renderer::SetLightUniforms(const std::vector<Vector2>& lightPos, const std::vector<float>& lightRadii, const std::vector<Vector3>& lightColors, const Vector3& ambient)
+void Renderer::SetLightUniforms(const FrameVector<Vector2>& lightPos, const FrameVector<float>& lightRadii, const FrameVector<Vector3>& lightColors, const Vector3& ambient)
 {
     SetActiveShader(mLightShader);
     
-    mLightShader->SetFloatUniform("uTime", static_cast<float>(SDL_GetTicks()) / 1000.0f);
+    mTime = static_cast<float>(SDL_GetTicks()) / 1000.0f;
+    mLightShader->SetFloatUniform("uTime", mTime);
     
     // Set ambient light
     mLightShader->SetVectorUniform("uAmbientLight", ambient);
@@ -345,19 +570,12 @@ void Renderer::SetLightUniforms(const std::vector<Vector2>& lightPos, const std:
     int numLights = std::min((int)lightPos.size(), 16);
     mLightShader->SetIntegerUniform("uNumLights", numLights);
     
-    // Set light positions and radii
-    // We need to pass arrays. Shader::SetVectorUniform doesn't support arrays directly usually, 
-    // but let's check Shader.h/cpp. If not, we loop.
-    
-    for (int i = 0; i < numLights; i++)
+    // Set light positions, radii and colors (one upload per array)
+    if (numLights > 0)
     {
-        std::string posName = "uLightPositions[" + std::to_string(i) + "]";
-        std::string radName = "uLightRadii[" + std::to_string(i) + "]";
-        std::string colName = "uLightColors[" + std::to_string(i) + "]";
-        
-        mLightShader->SetVectorUniform(posName.c_str(), lightPos[i]);
-        mLightShader->SetFloatUniform(radName.c_str(), lightRadii[i]);
-        mLightShader->SetVectorUniform(colName.c_str(), lightColors[i]);
+        mLightShader->SetVectorArrayUniform("uLightPositions", lightPos.data(), numLights);
+        mLightShader->SetFloatArrayUniform("uLightRadii", lightRadii.data(), numLights);
+        mLightShader->SetVectorArrayUniform("uLightColors", lightColors.data(), numLights);
     }
 }
 
@@ -375,6 +593,8 @@ void Renderer::SetFlashlightUniforms(bool active, const Vector2& pos, const Vect
 
 void Renderer::SetActiveShader(Shader* shader)
 {
+    FlushSpriteBatch();
+
     mActiveShader = shader;
     mActiveShader->SetActive();
 }
\ No newline at end of file
@@ -8,7 +8,9 @@
 #include "VertexArray.h"
 #include "Texture.h"
 #include "Font.h"
+#include "SpriteSheetCache.h"
 #include "../UI/UIElement.h"
+#include "../Memory/FrameArena.h"
 
 enum class RendererMode
 {
@@ -20,43 +22,64 @@ class Renderer
 {
 public:
 	Renderer(SDL_Window* window);
-	~Renderer();
+	virtual ~Renderer();
 
-	bool Initialize(float width, float height);
-	void Shutdown();
+	virtual bool Initialize(float width, float height);
+	virtual void Shutdown();
 
-    void SetZoom(float zoom);
+    virtual void SetZoom(float zoom);
 
-    void DrawRect(const Vector2 &position, const Vector2 &size,  float rotation,
+    virtual void DrawRect(const Vector2 &position, const Vector2 &size,  float rotation,
                   const Vector3 &color, const Vector2 &cameraPos, RendererMode mode, float alpha = 1.0f);
 
-    void DrawTexture(const Vector2 &position, const Vector2 &size,  float rotation,
+    virtual void DrawTexture(const Vector2 &position, const Vector2 &size,  float rotation,
                      const Vector3 &color, Texture *texture,
                      const Vector4 &textureRect = Vector4::UnitRect,
                      const Vector2 &cameraPos = Vector2::Zero, const Vector2 &scale = Vector2(1.0f, 1.0f),
                      float textureFactor = 1.0f, float alpha = 1.0f, bool isVegetation = false, bool isCircle = false);
 
-    void DrawGeometry(const Vector2 &position, const Vector2 &size,  float rotation,
+    virtual void DrawGeometry(const Vector2 &position, const Vector2 &size,  float rotation,
                       const Vector3 &color, const Vector2 &cameraPos, VertexArray *vertexArray, RendererMode mode);
 
-    void Clear();
-    void Present();
+    // Draws a vertex array already in world space (e.g. baked tile chunks)
+    virtual void DrawWorldGeometry(VertexArray *vertexArray, Texture *texture, const Vector2 &cameraPos,
+                           const Vector3 &color = Vector3::One, float alpha = 1.0f);
+
+    virtual void Clear();
+    virtual void Present();
+
+    // Draws everything queued in the sprite batch. Called automatically before
+    // any state change; only code issuing its own GL draws needs to call it.
+    virtual void FlushSpriteBatch();
+
+    // Draw calls issued by the renderer during the last presented frame
+    int GetDrawCallCount() const { return mLastFrameDrawCalls; }
+    int GetBatchedSpriteCount() const { return mLastFrameBatchedSprites; }
+
+    // Approximate memory of the cached textures (RGBA8, no mipmaps)
+    size_t GetTextureBytes() const;
 
     void AddUIElement(class UIElement* element);
     void RemoveUIElement(class UIElement* element);
-    void DrawUI(class Shader* shader);
+    virtual void DrawUI(class Shader* shader);
 
     class VertexArray* GetSpriteVerts() { return mSpriteVerts; }
 
     // Getters
     class Texture* GetTexture(const std::string& fileName);
+    // Parsed once per (texture, json) pair and shared by every caller
+    std::shared_ptr<const SpriteSheet> GetSpriteSheet(const std::string& texturePath, const std::string& dataPath);
 	class Shader* GetBaseShader() const { return mBaseShader; }
 	class Shader* GetLightShader() const { return mLightShader; }
     class Font* GetFont(const std::string& fileName);
 
-    void SetLightUniforms(const std::vector<Vector2>& lightPos, const std::vector<float>& lightRadii, const std::vector<Vector3>& lightColors, const Vector3& ambient);
-    void SetFlashlightUniforms(bool active, const Vector2& pos, const Vector2& dir);
-    void SetActiveShader(class Shader* shader);
+    virtual void SetLightUniforms(const FrameVector<Vector2>& lightPos, const FrameVector<float>& lightRadii, const FrameVector<Vector3>& lightColors, const Vector3& ambient);
+    virtual void SetFlashlightUniforms(bool active, const Vector2& pos, const Vector2& dir);
+    virtual void SetActiveShader(class Shader* shader);
+
+protected:
+    // Frees the cached textures, sheets and fonts
+    void UnloadResources();
 
 private:
     void Draw(RendererMode mode, const Matrix4 &modelMatrix, const Vector2 &cameraPos, VertexArray *vertices,
@@ -65,6 +88,12 @@ private:
 
 	bool LoadShaders();
     void CreateSpriteVerts();
+    void CreateSpriteBatch();
+
+    // Queues a textured (or plain colored) quad with the same transform DrawTexture used
+    void BatchQuad(const Vector2 &position, const Vector2 &size, float rotation, const Vector3 &color,
+                   Texture *texture, const Vector4 &textureRect, const Vector2 &cameraPos,
+                   float textureFactor, float alpha, bool isVegetation, bool isCircle);
 
 	// Game
 	class Game* mGame;
@@ -85,6 +114,7 @@ private:
 
 	// Ortho projection for 2D shaders
 	Matrix4 mOrthoProjection;
+    float mZoom;
 
     float mScreenWidth;
     float mScreenHeight;
@@ -92,8 +122,38 @@ private:
     // Map of textures loaded
     std::unordered_map<std::string, class Texture*> mTextures;
 
+    // Sprite sheet frames, keyed by the textures above
+    SpriteSheetCache mSpriteSheets;
+
     // Map of fonts
     std::unordered_map<std::string, class Font*> mFonts;
 
     std::vector<class UIElement*> mUIElements;
+
+    // Sprite batch: quads are collected here and drawn together until the
+    // texture, shader, camera or any other GL state changes
+    struct BatchVertex
+    {
+        float x, y;
+        float u, v;
+        float r, g, b, a;
+        float globalAlpha, textureFactor, isCircle;
+    };
+
+    static const int MAX_BATCH_SPRITES = 2048;
+
+    std::vector<BatchVertex> mBatchVertices;
+    class Texture* mBatchTexture;
+    Vector2 mBatchCameraPos;
+    unsigned int mBatchVertexArray;
+    unsigned int mBatchVertexBuffer;
+    unsigned int mBatchIndexBuffer;
+
+    // Same clock the light shader uses for the vegetation wiggle
+    float mTime;
+
+    int mFrameDrawCalls;
+    int mFrameBatchedSprites;
+    int mLastFrameDrawCalls;
+    int mLastFrameBatchedSprites;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include <SDL.h>
 #include "Shader.h"
+#include "GLState.h"
+#include <cstring>
 #include <fstream>
 #include <sstream>
 
@@ -31,12 +33,19 @@ bool Shader::Load(const std::string& name)
 	glLinkProgram(mShaderProgram);
 
 	// Verify that the program linked successfully
-	return IsValidProgram();
+	if (!IsValidProgram())
+	{
+		return false;
+	}
+
+	CacheUniformLocations();
+	return true;
 }
 
 void Shader::Unload()
 {
 	// Delete the program/shaders
+	GLState::OnProgramDeleted(mShaderProgram);
 	glDeleteProgram(mShaderProgram);
 	glDeleteShader(mVertexShader);
 	glDeleteShader(mFragShader);
@@ -44,66 +53,155 @@ void Shader::Unload()
 	mShaderProgram = 0;
 	mVertexShader = 0;
 	mFragShader = 0;
+	mUniforms.clear();
 }
 
 void Shader::SetActive() const
 {
 	// Set this program as the active one
-	glUseProgram(mShaderProgram);
+	GLState::UseProgram(mShaderProgram);
 }
 
 void Shader::SetVectorUniform(const char* name, const Vector2& vector) const
 {
-    // Find the uniform by this name
-    GLint loc = glGetUniformLocation(mShaderProgram, name);
+    // Find the uniform by this name (skipped if it already holds this value)
+    GLint loc = PrepareUpload(name, vector.GetAsFloatPtr(), 2 * sizeof(float));
 
     // Send the vector data to the uniform
-    glUniform2fv(loc, 1, vector.GetAsFloatPtr());
+    if (loc >= 0)
+    {
+        glUniform2fv(loc, 1, vector.GetAsFloatPtr());
+    }
 }
 
 void Shader::SetVectorUniform(const char* name, const Vector3& vector) const
 {
-	// Find the uniform by this name
-	GLint loc = glGetUniformLocation(mShaderProgram, name);
-
-	// Send the vector data to the uniform
-	glUniform3fv(loc, 1, vector.GetAsFloatPtr());
+	GLint loc = PrepareUpload(name, vector.GetAsFloatPtr(), 3 * sizeof(float));
+	if (loc >= 0)
+	{
+		glUniform3fv(loc, 1, vector.GetAsFloatPtr());
+	}
 }
 
 void Shader::SetVectorUniform(const char* name, const Vector4& vector) const
 {
-    // Find the uniform by this name
-    GLint loc = glGetUniformLocation(mShaderProgram, name);
-
-    // Send the vector data to the uniform
-    glUniform4fv(loc, 1, vector.GetAsFloatPtr());
+    GLint loc = PrepareUpload(name, vector.GetAsFloatPtr(), 4 * sizeof(float));
+    if (loc >= 0)
+    {
+        glUniform4fv(loc, 1, vector.GetAsFloatPtr());
+    }
 }
 
 void Shader::SetMatrixUniform(const char* name, const Matrix4& matrix) const
 {
-	// Find the uniform by this name
-	GLuint loc = glGetUniformLocation(mShaderProgram, name);
-
-    // Send the matrix data to the uniform
-	glUniformMatrix4fv(loc, 1, GL_FALSE, matrix.GetAsFloatPtr());
+	GLint loc = PrepareUpload(name, matrix.GetAsFloatPtr(), 16 * sizeof(float));
+	if (loc >= 0)
+	{
+		glUniformMatrix4fv(loc, 1, GL_FALSE, matrix.GetAsFloatPtr());
+	}
 }
 
 void Shader::SetFloatUniform(const char *name, float value) const
 {
-    // Find the uniform by this name
-    GLuint loc = glGetUniformLocation(mShaderProgram, name);
-
-    // Send the float data to the uniform
-    glUniform1f(loc, value);
+    GLint loc = PrepareUpload(name, &value, sizeof(float));
+    if (loc >= 0)
+    {
+        glUniform1f(loc, value);
+    }
 }
 
 void Shader::SetIntegerUniform(const char *name, int value) const
 {
-	// Find the uniform by this name
-	GLuint loc = glGetUniformLocation(mShaderProgram, name);
+	GLint loc = PrepareUpload(name, &value, sizeof(int));
+	if (loc >= 0)
+	{
+		glUniform1i(loc, value);
+	}
+}
+
+void Shader::SetVectorArrayUniform(const char* name, const Vector2* values, int count) const
+{
+	GLint loc = PrepareUpload(name, values, count * sizeof(Vector2));
+	if (loc >= 0)
+	{
+		glUniform2fv(loc, count, reinterpret_cast<const float*>(values));
+	}
+}
+
+void Shader::SetVectorArrayUniform(const char* name, const Vector3* values, int count) const
+{
+	GLint loc = PrepareUpload(name, values, count * sizeof(Vector3));
+	if (loc >= 0)
+	{
+		glUniform3fv(loc, count, reinterpret_cast<const float*>(values));
+	}
+}
+
+void Shader::SetFloatArrayUniform(const char* name, const float* values, int count) const
+{
+	GLint loc = PrepareUpload(name, values, count * sizeof(float));
+	if (loc >= 0)
+	{
+		glUniform1fv(loc, count, values);
+	}
+}
+
+void Shader::CacheUniformLocations()
+{
+	mUniforms.clear();
+
+	GLint numUniforms = 0;
+	glGetProgramiv(mShaderProgram, GL_ACTIVE_UNIFORMS, &numUniforms);
+
+	for (GLint i = 0; i < numUniforms; i++)
+	{
+		char buffer[256];
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveUniform(mShaderProgram, i, sizeof(buffer), &length, &size, &type, buffer);
+
+		std::string name(buffer, length);
+		size_t bracket = name.find('[');
+		if (bracket == std::string::npos)
+		{
+			mUniforms[name] = UniformSlot{ glGetUniformLocation(mShaderProgram, name.c_str()), {} };
+			continue;
+		}
+
+		// Arrays come back as "name[0]"
+		std::string baseName = name.substr(0, bracket);
+		mUniforms[baseName] = UniformSlot{ glGetUniformLocation(mShaderProgram, baseName.c_str()), {} };
+		for (GLint element = 0; element < size; element++)
+		{
+			std::string elementName = baseName + "[" + std::to_string(element) + "]";
+			mUniforms[elementName] = UniformSlot{ glGetUniformLocation(mShaderProgram, elementName.c_str()), {} };
+		}
+	}
+}
+
+GLint Shader::PrepareUpload(const char* name, const void* data, size_t size) const
+{
+	mLookupKey.assign(name);
+	auto iter = mUniforms.find(mLookupKey);
+	if (iter == mUniforms.end() || iter->second.location < 0)
+	{
+		// Optimized out or not declared in this program: GL would ignore it anyway
+		GLState::CountUniform(true);
+		return -1;
+	}
+
+	UniformSlot& slot = iter->second;
+	const auto* bytes = static_cast<const unsigned char*>(data);
+	if (slot.lastValue.size() == size && std::memcmp(slot.lastValue.data(), bytes, size) == 0)
+	{
+		GLState::CountUniform(true);
+		return -1;
+	}
 
-	// Send the integer data to the uniform
-    glUniform1i(loc, value);
+	slot.lastValue.assign(bytes, bytes + size);
+	GLState::CountUniform(false);
+	return slot.location;
 }
 
 bool Shader::CompileShader(const std::string& fileName, GLenum shaderType, GLuint& outShader)
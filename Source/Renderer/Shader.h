@@ -1,6 +1,8 @@
 #pragma once
 #include <GL/glew.h>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "../Math.h"
 
 class Shader
@@ -25,6 +27,12 @@ public:
     void SetFloatUniform(const char* name, float value) const;
     void SetIntegerUniform(const char *name, int value) const;
 
+    // Uploads a whole uniform array at once (e.g. "uLightPositions").
+    // Don't mix with per-element sets of the same array: they are cached separately.
+    void SetVectorArrayUniform(const char* name, const Vector2* values, int count) const;
+    void SetVectorArrayUniform(const char* name, const Vector3* values, int count) const;
+    void SetFloatArrayUniform(const char* name, const float* values, int count) const;
+
 private:
 	// Tries to compile the specified shader
 	bool CompileShader(const std::string& fileName, GLenum shaderType, GLuint& outShader);
@@ -34,6 +42,24 @@ private:
 	// Tests whether vertex/fragment programs link
 	bool IsValidProgram() const;
 
+	// Resolves the location of every active uniform once, after linking
+	void CacheUniformLocations();
+
+	// Returns the location to upload to, or -1 if the uniform doesn't exist
+	// or already holds exactly these bytes
+	GLint PrepareUpload(const char* name, const void* data, size_t size) const;
+
+	struct UniformSlot
+	{
+		GLint location;
+		std::vector<unsigned char> lastValue;
+	};
+
+	// Arrays are registered both by base name and per element
+	mutable std::unordered_map<std::string, UniformSlot> mUniforms;
+	// Key for mUniforms lookups, reused so a lookup doesn't allocate
+	mutable std::string mLookupKey;
+
 	// Store the shader object IDs
 	GLuint mVertexShader;
 	GLuint mFragShader;
@@ -0,0 +1,118 @@
+#include "SpriteSheetCache.h"
+#include "Texture.h"
+#include "../Json.h"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    void AppendFrame(SpriteSheet& sheet, const nlohmann::json& frameNode, float textureWidth, float textureHeight)
+    {
+        if (!frameNode.contains("frame")) {
+            return;
+        }
+
+        const auto& frame = frameNode["frame"];
+        int x = frame["x"].get<int>();
+        int y = frame["y"].get<int>();
+        int w = frame["w"].get<int>();
+        int h = frame["h"].get<int>();
+
+        if (w <= 0 || h <= 0) {
+            return;
+        }
+
+        SpriteFrame spriteFrame{};
+        spriteFrame.texture = sheet.texture;
+        spriteFrame.texRect = Vector4(
+                static_cast<float>(x) / textureWidth,
+                static_cast<float>(y) / textureHeight,
+                static_cast<float>(w) / textureWidth,
+                static_cast<float>(h) / textureHeight);
+        spriteFrame.srcRect = SDL_Rect{ x, y, w, h };
+        spriteFrame.pixelSize = Vector2(static_cast<float>(w), static_cast<float>(h));
+
+        sheet.frames.emplace_back(spriteFrame);
+    }
+}
+
+std::shared_ptr<const SpriteSheet> SpriteSheetCache::Get(Texture* texture, const std::string& dataPath)
+{
+    if (!texture) {
+        return nullptr;
+    }
+
+    auto key = std::make_pair(texture, dataPath);
+    auto iter = mSheets.find(key);
+    if (iter != mSheets.end()) {
+        return iter->second;
+    }
+
+    auto sheet = Load(texture, dataPath);
+    mSheets.emplace(key, sheet);
+    return sheet;
+}
+
+std::shared_ptr<const SpriteSheet> SpriteSheetCache::Load(Texture* texture, const std::string& dataPath)
+{
+    auto sheet = std::make_shared<SpriteSheet>();
+    sheet->texture = texture;
+
+    if (dataPath.empty()) {
+        SpriteFrame frame{};
+        frame.texture = texture;
+        frame.texRect = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+        frame.srcRect = SDL_Rect{ 0, 0, texture->GetWidth(), texture->GetHeight() };
+        frame.pixelSize = Vector2(static_cast<float>(texture->GetWidth()), static_cast<float>(texture->GetHeight()));
+        sheet->frames.emplace_back(frame);
+        return sheet;
+    }
+
+    std::ifstream spriteSheetFile(dataPath);
+
+    if (!spriteSheetFile.is_open()) {
+        SDL_Log("Failed to open sprite sheet data file: %s", dataPath.c_str());
+        return nullptr;
+    }
+
+    nlohmann::json spriteSheetData = nlohmann::json::parse(spriteSheetFile, nullptr, false);
+
+    if (spriteSheetData.is_discarded()) {
+        SDL_Log("Failed to parse sprite sheet data file: %s", dataPath.c_str());
+        return nullptr;
+    }
+
+    auto textureWidth = static_cast<float>(spriteSheetData["meta"]["size"]["w"].get<int>());
+    auto textureHeight = static_cast<float>(spriteSheetData["meta"]["size"]["h"].get<int>());
+
+    const auto& framesNode = spriteSheetData["frames"];
+
+    if (framesNode.is_array()) {
+        for (const auto& frame : framesNode) {
+            AppendFrame(*sheet, frame, textureWidth, textureHeight);
+        }
+    }
+    else if (framesNode.is_object()) {
+        std::vector<std::string> keys;
+        for (auto it = framesNode.begin(); it != framesNode.end(); ++it) {
+            keys.push_back(it.key());
+        }
+        std::sort(keys.begin(), keys.end());
+
+        for (const auto& key : keys) {
+            AppendFrame(*sheet, framesNode[key], textureWidth, textureHeight);
+        }
+    }
+
+    const auto& meta = spriteSheetData["meta"];
+    if (meta.contains("frameTags") && meta["frameTags"].is_array()) {
+        for (const auto& tag : meta["frameTags"]) {
+            if (tag.contains("name") && tag.contains("from") && tag.contains("to")) {
+                sheet->tags.emplace(tag["name"].get<std::string>(),
+                                    std::make_pair(tag["from"].get<int>(), tag["to"].get<int>()));
+            }
+        }
+    }
+
+    return sheet;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <SDL.h>
+#include "../Math.h"
+
+struct SpriteFrame
+{
+    class Texture* texture;
+    // Normalized rect inside texture
+    Vector4 texRect;
+    // Same rect in pixels
+    SDL_Rect srcRect;
+    Vector2 pixelSize;
+};
+
+// Frames of one (texture, Aseprite json) pair. Shared by every animator
+// using the sheet, so it is never modified after being parsed.
+struct SpriteSheet
+{
+    class Texture* texture;
+    std::vector<SpriteFrame> frames;
+
+    // Aseprite frameTags: name -> inclusive [from, to] frame range
+    std::unordered_map<std::string, std::pair<int, int>> tags;
+};
+
+class SpriteSheetCache
+{
+public:
+    // Parses dataPath on the first request and hands out the same sheet afterwards.
+    // An empty dataPath gives a single frame covering the whole texture.
+    // Returns nullptr when texture is null or the json can't be read.
+    std::shared_ptr<const SpriteSheet> Get(class Texture* texture, const std::string& dataPath);
+
+    void Clear() { mSheets.clear(); }
+
+private:
+    static std::shared_ptr<const SpriteSheet> Load(class Texture* texture, const std::string& dataPath);
+
+    // Failed loads are kept too (as nullptr) so the file isn't retried every spawn
+    std::map<std::pair<class Texture*, std::string>, std::shared_ptr<const SpriteSheet>> mSheets;
+};
@@ -1,4 +1,5 @@
 #include "Texture.h"
+#include "GLState.h"
 
 Texture::Texture()
 : mTextureID(0)
@@ -23,13 +24,19 @@ bool Texture::Load(const std::string &filePath)
     mWidth = surface->w;
     mHeight = surface->h;
 
+    // Headless: only the size is needed
+    if (!GLState::HasContext()) {
+        SDL_FreeSurface(surface);
+        return true;
+    }
+
     int format = GL_RGB;
     if (surface->format->BytesPerPixel == 4) {
         format = GL_RGBA;
     }
 
     glGenTextures(1, &mTextureID);
-    glBindTexture(GL_TEXTURE_2D, mTextureID);
+    GLState::BindTexture(mTextureID);
 
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 
@@ -45,6 +52,12 @@ bool Texture::Load(const std::string &filePath)
 
 void Texture::Unload()
 {
+	if (mTextureID == 0)
+	{
+		return;
+	}
+
+	GLState::OnTextureDeleted(mTextureID);
 	glDeleteTextures(1, &mTextureID);
 }
 
@@ -53,8 +66,12 @@ void Texture::CreateFromSurface(SDL_Surface* surface)
     mWidth = surface->w;
     mHeight = surface->h;
 
+    if (!GLState::HasContext()) {
+        return;
+    }
+
     glGenTextures(1, &mTextureID);
-    glBindTexture(GL_TEXTURE_2D, mTextureID);
+    GLState::BindTexture(mTextureID);
     
     // Configura para ler a superfície do SDL_ttf (Texto)
     glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch / 4);
@@ -70,6 +87,5 @@ void Texture::CreateFromSurface(SDL_Surface* surface)
 
 void Texture::SetActive(int index) const
 {
-    glActiveTexture(GL_TEXTURE0 + index);
-    glBindTexture(GL_TEXTURE_2D, mTextureID);
+    GLState::BindTexture(mTextureID, index);
 }
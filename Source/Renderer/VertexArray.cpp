@@ -1,4 +1,5 @@
 #include "VertexArray.h"
+#include "GLState.h"
 #include <GL/glew.h>
 
 VertexArray::VertexArray(const float* verts, unsigned int numVerts, const unsigned int* indices,
@@ -9,9 +10,15 @@ VertexArray::VertexArray(const float* verts, unsigned int numVerts, const unsign
 , mIndexBuffer(0)
 , mVertexArray(0)
 {
+    // Headless: no GL objects, the counts are all anyone reads
+    if (!GLState::HasContext())
+    {
+        return;
+    }
+
 // Create vertex array
     glGenVertexArrays(1, &mVertexArray);
-    glBindVertexArray(mVertexArray);
+    GLState::BindVertexArray(mVertexArray);
 
     // Create vertex buffer
     glGenBuffers(1, &mVertexBuffer);
@@ -35,13 +42,19 @@ VertexArray::VertexArray(const float* verts, unsigned int numVerts, const unsign
 
 VertexArray::~VertexArray()
 {
+	if (mVertexArray == 0)
+	{
+		return;
+	}
+
 	glDeleteBuffers(1, &mVertexBuffer);
 	glDeleteBuffers(1, &mIndexBuffer);
+	GLState::OnVertexArrayDeleted(mVertexArray);
 	glDeleteVertexArrays(1, &mVertexArray);
 }
 
 void VertexArray::SetActive() const
 {
-	glBindVertexArray(mVertexArray);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+	// The index buffer binding is part of the VAO state, so this is enough
+	GLState::BindVertexArray(mVertexArray);
 }
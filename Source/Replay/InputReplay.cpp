@@ -0,0 +1,349 @@
+#include "InputReplay.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+    const char REPLAY_MAGIC[4] = { 'C', 'D', 'R', 'P' };
+    // 3: enemy AI moved to the think phase, so older recordings play out differently
+    const uint16_t REPLAY_VERSION = 3;
+
+    // Tick flags: which parts changed since the previous tick
+    const uint8_t TICK_EVENTS = 1 << 0;
+    const uint8_t TICK_KEYS = 1 << 1;
+    const uint8_t TICK_MOUSE = 1 << 2;
+
+    enum class EventKind : uint8_t
+    {
+        MouseMotion,
+        MouseWheel,
+        MouseButtonDown,
+        KeyDown
+    };
+
+    // Values are stored in host byte order; replays are meant for the machine that recorded them
+    template <typename T>
+    void Write(std::ofstream& file, T value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool Read(std::ifstream& file, T& value)
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+InputRecorder::InputRecorder()
+    : mTickCount(0)
+{
+}
+
+InputRecorder::~InputRecorder()
+{
+    Close();
+}
+
+bool InputRecorder::Open(const std::string& fileName, const ReplayHeader& header)
+{
+    mFile.open(fileName, std::ios::binary | std::ios::trunc);
+    if (!mFile.is_open())
+    {
+        SDL_Log("Failed to open replay file for writing: %s", fileName.c_str());
+        return false;
+    }
+
+    mFile.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    Write<uint16_t>(mFile, REPLAY_VERSION);
+    Write<uint16_t>(mFile, SDL_NUM_SCANCODES);
+    Write<uint32_t>(mFile, header.seed);
+    Write<float>(mFile, header.tickRate);
+    Write<int32_t>(mFile, header.windowWidth);
+    Write<int32_t>(mFile, header.windowHeight);
+    Write<uint8_t>(mFile, header.systemUpdate ? 1 : 0);
+
+    mLast = InputFrame();
+    mLast.keys.assign(SDL_NUM_SCANCODES, 0);
+    mPendingEvents.clear();
+    mTickCount = 0;
+    return true;
+}
+
+void InputRecorder::Close()
+{
+    if (mFile.is_open())
+    {
+        mFile.close();
+        SDL_Log("Replay recorded: %llu ticks", static_cast<unsigned long long>(mTickCount));
+    }
+}
+
+void InputRecorder::RecordEvent(const SDL_Event& event)
+{
+    switch (event.type)
+    {
+        case SDL_MOUSEMOTION:
+        case SDL_MOUSEWHEEL:
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_KEYDOWN:
+            mPendingEvents.emplace_back(event);
+            break;
+        default:
+            break;
+    }
+}
+
+void InputRecorder::RecordTick(const Uint8* keys, int mouseX, int mouseY, Uint32 mouseButtons)
+{
+    if (!mFile.is_open())
+    {
+        return;
+    }
+
+    std::vector<uint16_t> changedKeys;
+    for (int i = 0; i < SDL_NUM_SCANCODES; i++)
+    {
+        if ((keys[i] != 0) != (mLast.keys[i] != 0))
+        {
+            changedKeys.emplace_back(static_cast<uint16_t>(i));
+            mLast.keys[i] = keys[i] ? 1 : 0;
+        }
+    }
+
+    bool mouseChanged = mouseX != mLast.mouseX || mouseY != mLast.mouseY || mouseButtons != mLast.mouseButtons;
+
+    uint8_t flags = 0;
+    if (!mPendingEvents.empty()) flags |= TICK_EVENTS;
+    if (!changedKeys.empty()) flags |= TICK_KEYS;
+    if (mouseChanged) flags |= TICK_MOUSE;
+    Write<uint8_t>(mFile, flags);
+
+    if (flags & TICK_EVENTS)
+    {
+        Write<uint16_t>(mFile, static_cast<uint16_t>(mPendingEvents.size()));
+        for (const auto& event : mPendingEvents)
+        {
+            switch (event.type)
+            {
+                case SDL_MOUSEMOTION:
+                    Write<uint8_t>(mFile, static_cast<uint8_t>(EventKind::MouseMotion));
+                    Write<int32_t>(mFile, event.motion.x);
+                    Write<int32_t>(mFile, event.motion.y);
+                    break;
+                case SDL_MOUSEWHEEL:
+                    Write<uint8_t>(mFile, static_cast<uint8_t>(EventKind::MouseWheel));
+                    Write<int32_t>(mFile, event.wheel.y);
+                    break;
+                case SDL_MOUSEBUTTONDOWN:
+                    Write<uint8_t>(mFile, static_cast<uint8_t>(EventKind::MouseButtonDown));
+                    Write<uint8_t>(mFile, event.button.button);
+                    Write<int32_t>(mFile, event.button.x);
+                    Write<int32_t>(mFile, event.button.y);
+                    break;
+                case SDL_KEYDOWN:
+                    Write<uint8_t>(mFile, static_cast<uint8_t>(EventKind::KeyDown));
+                    Write<int32_t>(mFile, event.key.keysym.sym);
+                    Write<uint16_t>(mFile, static_cast<uint16_t>(event.key.keysym.scancode));
+                    Write<uint16_t>(mFile, event.key.keysym.mod);
+                    Write<uint8_t>(mFile, event.key.repeat);
+                    break;
+            }
+        }
+        mPendingEvents.clear();
+    }
+
+    if (flags & TICK_KEYS)
+    {
+        Write<uint16_t>(mFile, static_cast<uint16_t>(changedKeys.size()));
+        for (uint16_t scancode : changedKeys)
+        {
+            Write<uint16_t>(mFile, scancode);
+        }
+    }
+
+    if (flags & TICK_MOUSE)
+    {
+        Write<int32_t>(mFile, mouseX);
+        Write<int32_t>(mFile, mouseY);
+        Write<uint32_t>(mFile, mouseButtons);
+        mLast.mouseX = mouseX;
+        mLast.mouseY = mouseY;
+        mLast.mouseButtons = mouseButtons;
+    }
+
+    mTickCount++;
+}
+
+InputReplay::InputReplay()
+    : mHashToStdout(false)
+{
+}
+
+InputReplay::~InputReplay()
+{
+}
+
+bool InputReplay::Open(const std::string& fileName)
+{
+    mFile.open(fileName, std::ios::binary);
+    if (!mFile.is_open())
+    {
+        SDL_Log("Failed to open replay file: %s", fileName.c_str());
+        return false;
+    }
+
+    char magic[4];
+    uint16_t version = 0;
+    uint16_t keyCount = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+    uint8_t systemUpdate = 0;
+    if (!mFile.read(magic, sizeof(magic)) || std::memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 ||
+        !Read(mFile, version) || version != REPLAY_VERSION ||
+        !Read(mFile, keyCount) || keyCount != SDL_NUM_SCANCODES ||
+        !Read(mFile, mHeader.seed) || !Read(mFile, mHeader.tickRate) ||
+        !Read(mFile, width) || !Read(mFile, height) || !Read(mFile, systemUpdate))
+    {
+        SDL_Log("Not a replay file (or from another version): %s", fileName.c_str());
+        mFile.close();
+        return false;
+    }
+
+    mHeader.windowWidth = width;
+    mHeader.windowHeight = height;
+    mHeader.systemUpdate = systemUpdate != 0;
+
+    mCurrent = InputFrame();
+    mCurrent.keys.assign(SDL_NUM_SCANCODES, 0);
+    return true;
+}
+
+const InputFrame* InputReplay::ReadTick()
+{
+    uint8_t flags = 0;
+    if (!mFile.is_open() || !Read(mFile, flags))
+    {
+        return nullptr;
+    }
+
+    mCurrent.events.clear();
+
+    if (flags & TICK_EVENTS)
+    {
+        uint16_t count = 0;
+        Read(mFile, count);
+        for (uint16_t i = 0; i < count; i++)
+        {
+            uint8_t kind = 0;
+            Read(mFile, kind);
+
+            SDL_Event event;
+            std::memset(&event, 0, sizeof(event));
+            switch (static_cast<EventKind>(kind))
+            {
+                case EventKind::MouseMotion:
+                    event.type = SDL_MOUSEMOTION;
+                    Read(mFile, event.motion.x);
+                    Read(mFile, event.motion.y);
+                    break;
+                case EventKind::MouseWheel:
+                    event.type = SDL_MOUSEWHEEL;
+                    Read(mFile, event.wheel.y);
+                    break;
+                case EventKind::MouseButtonDown:
+                    event.type = SDL_MOUSEBUTTONDOWN;
+                    Read(mFile, event.button.button);
+                    Read(mFile, event.button.x);
+                    Read(mFile, event.button.y);
+                    break;
+                case EventKind::KeyDown:
+                {
+                    event.type = SDL_KEYDOWN;
+                    int32_t sym = 0;
+                    uint16_t scancode = 0;
+                    Read(mFile, sym);
+                    Read(mFile, scancode);
+                    Read(mFile, event.key.keysym.mod);
+                    Read(mFile, event.key.repeat);
+                    event.key.keysym.sym = sym;
+                    event.key.keysym.scancode = static_cast<SDL_Scancode>(scancode);
+                    break;
+                }
+                default:
+                    SDL_Log("Corrupt replay file: unknown event kind %d", kind);
+                    mFile.close();
+                    return nullptr;
+            }
+            mCurrent.events.emplace_back(event);
+        }
+    }
+
+    if (flags & TICK_KEYS)
+    {
+        uint16_t count = 0;
+        Read(mFile, count);
+        for (uint16_t i = 0; i < count; i++)
+        {
+            uint16_t scancode = 0;
+            Read(mFile, scancode);
+            if (scancode < SDL_NUM_SCANCODES)
+            {
+                mCurrent.keys[scancode] = mCurrent.keys[scancode] ? 0 : 1;
+            }
+        }
+    }
+
+    if (flags & TICK_MOUSE)
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+        Read(mFile, x);
+        Read(mFile, y);
+        Read(mFile, mCurrent.mouseButtons);
+        mCurrent.mouseX = x;
+        mCurrent.mouseY = y;
+    }
+
+    if (!mFile)
+    {
+        SDL_Log("Corrupt replay file: truncated tick");
+        return nullptr;
+    }
+
+    return &mCurrent;
+}
+
+bool InputReplay::OpenHashLog(const std::string& hashFileName)
+{
+    if (hashFileName.empty())
+    {
+        mHashToStdout = true;
+        return true;
+    }
+
+    mHashFile.open(hashFileName, std::ios::trunc);
+    if (!mHashFile.is_open())
+    {
+        SDL_Log("Failed to open hash log: %s", hashFileName.c_str());
+        return false;
+    }
+    return true;
+}
+
+void InputReplay::LogStateHash(uint64_t tick, uint64_t hash)
+{
+    char line[64];
+    std::snprintf(line, sizeof(line), "%llu %016llx\n",
+                  static_cast<unsigned long long>(tick), static_cast<unsigned long long>(hash));
+
+    if (mHashFile.is_open())
+    {
+        mHashFile << line;
+    }
+    else if (mHashToStdout)
+    {
+        std::cout << line;
+    }
+}
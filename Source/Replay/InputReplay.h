@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+// Everything that has to match for a replay to reproduce a recording
+struct ReplayHeader
+{
+    uint32_t seed = 0;
+    float tickRate = 60.0f;
+    int windowWidth = 0;
+    int windowHeight = 0;
+    // Game::SetSystemUpdate; the update order changes the simulation
+    bool systemUpdate = false;
+};
+
+// Input consumed by one simulation tick: the events Game::ProcessInput
+// handled since the previous tick, then the keyboard and mouse state the
+// actors read during the tick
+struct InputFrame
+{
+    std::vector<SDL_Event> events;
+    std::vector<Uint8> keys;
+    int mouseX = 0;
+    int mouseY = 0;
+    Uint32 mouseButtons = 0;
+};
+
+// Writes a replay file. Ticks are delta-encoded against the previous one,
+// so a tick where nothing changed takes a single byte.
+class InputRecorder
+{
+public:
+    InputRecorder();
+    ~InputRecorder();
+
+    bool Open(const std::string& fileName, const ReplayHeader& header);
+    void Close();
+
+    // Only the event types Game reacts to are kept; they go out with the next tick
+    void RecordEvent(const SDL_Event& event);
+    void RecordTick(const Uint8* keys, int mouseX, int mouseY, Uint32 mouseButtons);
+
+    uint64_t GetTickCount() const { return mTickCount; }
+
+private:
+    std::ofstream mFile;
+    std::vector<SDL_Event> mPendingEvents;
+    InputFrame mLast;
+    uint64_t mTickCount;
+};
+
+// Reads a replay file back one tick at a time and logs the state hash of
+// every tick, so two runs of the same recording can be diffed.
+class InputReplay
+{
+public:
+    InputReplay();
+    ~InputReplay();
+
+    bool Open(const std::string& fileName);
+    const ReplayHeader& GetHeader() const { return mHeader; }
+
+    // Input of the next tick, valid until the following call; null once the recording is over
+    const InputFrame* ReadTick();
+
+    // One "tick hash" line per tick, to hashFileName or stdout when empty
+    bool OpenHashLog(const std::string& hashFileName);
+    void LogStateHash(uint64_t tick, uint64_t hash);
+
+private:
+    std::ifstream mFile;
+    ReplayHeader mHeader;
+    // Keyboard and mouse carry over between ticks, only changes are stored
+    InputFrame mCurrent;
+
+    std::ofstream mHashFile;
+    bool mHashToStdout;
+};
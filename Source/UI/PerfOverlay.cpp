@@ -0,0 +1,221 @@
+#include "PerfOverlay.h"
+#include <algorithm>
+#include <cstdio>
+#include "../Game.h"
+#include "../AudioSystem.h"
+#include "../Renderer/Renderer.h"
+#include "../Renderer/Font.h"
+#include "../Renderer/GLState.h"
+#include "../Components/Drawing/DrawableRegistry.h"
+#include "../Components/Physics/AABBColliderComponent.h"
+#include "../Particles/ParticleEngine.h"
+#include "../Jobs/JobSystem.h"
+#include "../Actors/ActorPool.h"
+#include "../Memory/FrameArena.h"
+#include "../Memory/HeapStats.h"
+
+namespace
+{
+    const char FIRST_GLYPH = 32;
+    const char LAST_GLYPH = 126;
+
+    const char* SERIES_NAMES[] = { "update", "submit", "present" };
+    const Vector3 SERIES_COLORS[] = {
+        Vector3(0.4f, 0.9f, 0.4f),
+        Vector3(0.95f, 0.8f, 0.3f),
+        Vector3(0.4f, 0.6f, 1.0f)
+    };
+
+    const float PANEL_WIDTH = 270.0f;
+    const float GRAPH_HEIGHT = 32.0f;
+    const float LINE_HEIGHT = 16.0f;
+    // Graph top is two frames at 60 FPS
+    const float GRAPH_MAX_MS = 1000.0f / 30.0f;
+}
+
+PerfOverlay::PerfOverlay(Game* game)
+    : mGame(game)
+    , mNextSample(0)
+    , mNumSamples(0)
+    , mPairTests(0)
+    , mJobUtilization(0.0f)
+    , mAllocationCount(HeapStats::GetAllocationCount())
+    , mFrameAllocations(0)
+    , mGlyphs(nullptr)
+{
+    std::fill(&mSamples[0][0], &mSamples[0][0] + NUM_SERIES * HISTORY, 0.0f);
+
+    std::string chars;
+    for (char c = FIRST_GLYPH; c <= LAST_GLYPH; c++)
+    {
+        chars += c;
+    }
+
+    Font* font = mGame->GetRenderer()->GetFont("../Assets/Fonts/ALS_Micro_Bold.ttf");
+    if (font)
+    {
+        mGlyphs = font->RenderGlyphAtlas(chars, mGlyphRects, mGlyphSizes, 14);
+    }
+}
+
+PerfOverlay::~PerfOverlay()
+{
+    if (mGlyphs)
+    {
+        mGlyphs->Unload();
+        delete mGlyphs;
+    }
+}
+
+void PerfOverlay::RecordFrame(float updateMs, float submitMs, float presentMs)
+{
+    mSamples[0][mNextSample] = updateMs;
+    mSamples[1][mNextSample] = submitMs;
+    mSamples[2][mNextSample] = presentMs;
+
+    mNextSample = (mNextSample + 1) % HISTORY;
+    mNumSamples = std::min(mNumSamples + 1, HISTORY);
+
+    mPairTests = AABBColliderComponent::TakePairTestCount();
+    mJobUtilization = mGame->GetJobs()->TakeUtilization();
+
+    size_t allocationCount = HeapStats::GetAllocationCount();
+    mFrameAllocations = allocationCount - mAllocationCount;
+    mAllocationCount = allocationCount;
+}
+
+float PerfOverlay::Percentile(int series, float fraction)
+{
+    if (mNumSamples == 0)
+    {
+        return 0.0f;
+    }
+
+    std::copy(mSamples[series], mSamples[series] + mNumSamples, mScratch);
+    int index = static_cast<int>(fraction * (mNumSamples - 1) + 0.5f);
+    std::nth_element(mScratch, mScratch + index, mScratch + mNumSamples);
+    return mScratch[index];
+}
+
+void PerfOverlay::DrawText(Renderer* renderer, const char* text, const Vector2& topLeft, const Vector3& color)
+{
+    if (!mGlyphs)
+    {
+        return;
+    }
+
+    float x = topLeft.x;
+    for (const char* c = text; *c; c++)
+    {
+        if (*c < FIRST_GLYPH || *c > LAST_GLYPH)
+        {
+            continue;
+        }
+
+        int glyph = *c - FIRST_GLYPH;
+        const Vector2& size = mGlyphSizes[glyph];
+        if (*c != ' ')
+        {
+            renderer->DrawTexture(Vector2(x + size.x * 0.5f, topLeft.y + size.y * 0.5f), size, 0.0f, color,
+                                  mGlyphs, mGlyphRects[glyph]);
+        }
+        x += size.x;
+    }
+}
+
+void PerfOverlay::Draw(Renderer* renderer)
+{
+    char line[96];
+
+    const float numCounterLines = 13.0f;
+    float panelHeight = NUM_SERIES * (LINE_HEIGHT + GRAPH_HEIGHT + 6.0f) + numCounterLines * LINE_HEIGHT + 16.0f;
+    Vector2 panelMin(Game::WINDOW_WIDTH - PANEL_WIDTH - 10.0f, 10.0f);
+
+    renderer->DrawRect(panelMin + Vector2(PANEL_WIDTH, panelHeight) * 0.5f, Vector2(PANEL_WIDTH, panelHeight), 0.0f,
+                       Vector3::Zero, Vector2::Zero, RendererMode::TRIANGLES, 0.7f);
+
+    float x = panelMin.x + 8.0f;
+    float y = panelMin.y + 6.0f;
+    float graphWidth = PANEL_WIDTH - 16.0f;
+    float barWidth = graphWidth / HISTORY;
+
+    for (int series = 0; series < NUM_SERIES; series++)
+    {
+        std::snprintf(line, sizeof(line), "%-8s p50 %5.2f  p99 %5.2f ms", SERIES_NAMES[series],
+                      Percentile(series, 0.5f), Percentile(series, 0.99f));
+        DrawText(renderer, line, Vector2(x, y), SERIES_COLORS[series]);
+        y += LINE_HEIGHT;
+
+        // Oldest sample on the left
+        float graphBottom = y + GRAPH_HEIGHT;
+        for (int i = 0; i < mNumSamples; i++)
+        {
+            int sample = (mNextSample - mNumSamples + i + HISTORY) % HISTORY;
+            float height = std::min(mSamples[series][sample] / GRAPH_MAX_MS, 1.0f) * GRAPH_HEIGHT;
+            if (height <= 0.0f)
+            {
+                continue;
+            }
+            renderer->DrawRect(Vector2(x + (i + 0.5f) * barWidth, graphBottom - height * 0.5f), Vector2(barWidth, height),
+                               0.0f, SERIES_COLORS[series], Vector2::Zero, RendererMode::TRIANGLES, 0.9f);
+        }
+
+        // 60 FPS budget
+        float budgetY = graphBottom - (1000.0f / Game::FPS) / GRAPH_MAX_MS * GRAPH_HEIGHT;
+        renderer->DrawRect(Vector2(x + graphWidth * 0.5f, budgetY), Vector2(graphWidth, 1.0f), 0.0f,
+                           Vector3(1.0f, 0.3f, 0.3f), Vector2::Zero, RendererMode::TRIANGLES, 0.8f);
+
+        y = graphBottom + 6.0f;
+    }
+
+    const Vector3 white(1.0f, 1.0f, 1.0f);
+    const GLState::Stats& glStats = GLState::GetLastFrameStats();
+
+    std::snprintf(line, sizeof(line), "actors      %zu", mGame->GetActorCount());
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    int pooledLive = 0;
+    int pooledPeak = 0;
+    for (const ActorPoolBase* pool : mGame->GetActorPools())
+    {
+        pooledLive += pool->GetLiveCount();
+        pooledPeak += pool->GetPeakCount();
+    }
+    std::snprintf(line, sizeof(line), "pooled      %d (peak %d)", pooledLive, pooledPeak);
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "drawables   %zu", mGame->GetDrawables().GetCount());
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "colliders   %zu", mGame->GetColliders().GetCount());
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "pair tests  %d", mPairTests);
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "particles   %d", mGame->GetParticleEngine()->GetLiveCount());
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "draw calls  %d (%d sprites)", renderer->GetDrawCallCount(), renderer->GetBatchedSpriteCount());
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "tex binds   %d (%d skipped)", glStats.textureBinds, glStats.textureBindsSkipped);
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "sound chans %d", mGame->GetAudio()->GetActiveChannelCount());
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "textures    %.1f MB", renderer->GetTextureBytes() / (1024.0f * 1024.0f));
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    std::snprintf(line, sizeof(line), "jobs        %d workers, %.0f%% busy", mGame->GetJobs()->GetWorkerCount(), mJobUtilization * 100.0f);
+    DrawText(renderer, line, Vector2(x, y), white);
+    y += LINE_HEIGHT;
+    // Goal in steady gameplay: 0
+    std::snprintf(line, sizeof(line), "heap allocs %zu", mFrameAllocations);
+    DrawText(renderer, line, Vector2(x, y), mFrameAllocations > 0 ? Vector3(1.0f, 0.5f, 0.3f) : white);
+    y += LINE_HEIGHT;
+    FrameArena* arena = mGame->GetFrameArena();
+    std::snprintf(line, sizeof(line), "frame arena %.0f / %.0f KB", arena->GetLastFrameBytes() / 1024.0f, arena->GetCapacity() / 1024.0f);
+    DrawText(renderer, line, Vector2(x, y), white);
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <vector>
+#include "../Math.h"
+
+// Frame time graphs and engine counters, toggled with F3. Everything is
+// allocated up front: a frame only formats into fixed buffers and queues
+// quads through the sprite batch.
+class PerfOverlay
+{
+public:
+    PerfOverlay(class Game* game);
+    ~PerfOverlay();
+
+    // Times of the frame that just finished, in milliseconds
+    void RecordFrame(float updateMs, float submitMs, float presentMs);
+
+    void Draw(class Renderer* renderer);
+
+private:
+    // About 4 seconds at 60 FPS
+    static const int HISTORY = 240;
+    static const int NUM_SERIES = 3;
+
+    // Fraction in [0, 1] of the recorded samples of one series
+    float Percentile(int series, float fraction);
+    void DrawText(class Renderer* renderer, const char* text, const Vector2& topLeft, const Vector3& color);
+
+    class Game* mGame;
+
+    float mSamples[NUM_SERIES][HISTORY];
+    float mScratch[HISTORY];
+    int mNextSample;
+    int mNumSamples;
+    int mPairTests;
+    float mJobUtilization;
+    size_t mAllocationCount;
+    size_t mFrameAllocations;
+
+    // Printable ASCII (32..126) rendered once into a single texture
+    class Texture* mGlyphs;
+    std::vector<Vector4> mGlyphRects;
+    std::vector<Vector2> mGlyphSizes;
+};
@@ -1,11 +1,9 @@
 #include "GameOver.h"
 #include "../../Game.h"
 #include <SDL.h>
-#include "../../Json.h"
-#include <fstream>
-#include <algorithm>
 #include "../UIImage.h"
 #include "../UIText.h"
+#include "../../Renderer/Renderer.h"
 #include "../../Renderer/Texture.h"
 
 GameOver::GameOver(class Game* game, const std::string& fontName, GameScene level)
@@ -53,61 +51,25 @@ GameOver::GameOver(class Game* game, const std::string& fontName, GameScene leve
         }
         else if (info.isEnemy)
         {
-            std::ifstream file(info.killerJsonPath);
-            if (file.is_open())
+            // Same parsed sheet the killer's animator used
+            std::shared_ptr<const SpriteSheet> sheet;
+            if (!info.killerJsonPath.empty()) {
+                sheet = game->GetRenderer()->GetSpriteSheet(info.killerSpritePath, info.killerJsonPath);
+            }
+
+            if (sheet)
             {
-                nlohmann::json json;
-                file >> json;
-                
-                std::vector<int> frameIndices;
-                if (json.contains("meta") && json["meta"].contains("frameTags")) {
-                    for (const auto& tag : json["meta"]["frameTags"]) {
-                        if (tag["name"] == "idle") {
-                            int from = tag["from"];
-                            int to = tag["to"];
-                            for (int i = from; i <= to; ++i) {
-                                frameIndices.push_back(i);
-                            }
-                            break;
-                        }
-                    }
-                }
-                
-                if (frameIndices.empty()) {
-                    frameIndices.push_back(0);
+                int from = 0;
+                int to = 0;
+                auto tag = sheet->tags.find("idle");
+                if (tag != sheet->tags.end()) {
+                    from = tag->second.first;
+                    to = tag->second.second;
                 }
 
-                if (json.contains("frames")) {
-                    if (json["frames"].is_array()) {
-                        for (int idx : frameIndices) {
-                            if (idx >= 0 && idx < json["frames"].size()) {
-                                auto& frame = json["frames"][idx]["frame"];
-                                SDL_Rect r;
-                                r.x = frame["x"];
-                                r.y = frame["y"];
-                                r.w = frame["w"];
-                                r.h = frame["h"];
-                                mIdleRects.push_back(r);
-                            }
-                        }
-                    } else if (json["frames"].is_object()) {
-                        std::vector<std::string> keys;
-                        for (auto it = json["frames"].begin(); it != json["frames"].end(); ++it) {
-                            keys.push_back(it.key());
-                        }
-                        std::sort(keys.begin(), keys.end());
-
-                        for (int idx : frameIndices) {
-                            if (idx >= 0 && idx < keys.size()) {
-                                auto& frame = json["frames"][keys[idx]]["frame"];
-                                SDL_Rect r;
-                                r.x = frame["x"];
-                                r.y = frame["y"];
-                                r.w = frame["w"];
-                                r.h = frame["h"];
-                                mIdleRects.push_back(r);
-                            }
-                        }
+                for (int idx = from; idx <= to; ++idx) {
+                    if (idx >= 0 && idx < static_cast<int>(sheet->frames.size())) {
+                        mIdleRects.push_back(sheet->frames[idx].srcRect);
                     }
                 }
             }
@@ -265,7 +265,8 @@ void InventoryScreen::HandleMouseClick(const Vector2& mousePos)
     if (clickedSlot != -1) {
         mSelectedSlotIndex = clickedSlot;
 
-        float time = SDL_GetTicks() / 1000.0f;
+        // Simulation time, so replays see the same double clicks
+        float time = mGame->GetTickIndex() / mGame->GetTickRate();
         if (clickedSlot == mLastClickedSlotIndex && time - mLastClickTime < 0.5f) {
             HandleDoubleClick(clickedSlot);
             mLastClickedSlotIndex = -1;
@@ -329,7 +330,7 @@ void InventoryScreen::Update(float deltaTime)
     // else mHandSlot.rect->SetColor(Vector4(0.5f, 0.5f, 0.5f, 1.0f));
     
     int mouseX, mouseY;
-    Uint32 buttons = SDL_GetMouseState(&mouseX, &mouseY);
+    Uint32 buttons = mGame->GetMouseState(&mouseX, &mouseY);
     Vector2 mousePos(static_cast<float>(mouseX), static_cast<float>(mouseY));
     bool isMouseDown = (buttons & SDL_BUTTON(SDL_BUTTON_LEFT));
 
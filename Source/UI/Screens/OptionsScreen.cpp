@@ -116,7 +116,7 @@ void OptionsScreen::HandleMouseMove(const Vector2& mousePos)
     UIScreen::HandleMouseMove(mousePos);
     
     int x, y;
-    Uint32 buttons = SDL_GetMouseState(&x, &y);
+    Uint32 buttons = mGame->GetMouseState(&x, &y);
     if ((buttons & SDL_BUTTON(SDL_BUTTON_LEFT)) == 0) return;
 
     // Reuse click logic for drag